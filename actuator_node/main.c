@@ -2,19 +2,154 @@
 
 // C STANDARD LIBRARY
 #include <stdbool.h>        // bool
+#include <stddef.h>         // NULL
+#include <string.h>         // memset
+
+// SOFTDEVICE
+#include "ble_gap.h"        // BLE_GAP_PHY_2MBPS
 
 // LUOS
-#include "luos.h"           // Luos_Init, Luos_Loop
+#include "luos.h"           /* Luos_Init, Luos_Loop,
+                            ** LUOS_PROTOCOL_NB
+                            */
 #include "led_toggler.h"    // LedToggler_Init, LedToggler_Loop
 
+// CUSTOM
+#include "ble_conn_tuner.h" /* BLE_CONN_TUNER_DEF, ble_conn_tuner_init,
+                            ** ble_conn_tuner_init_t
+                            */
+#include "ble_phy.h"        /* BLE_PHY_DEF, ble_phy_init, ble_phy_init_t,
+                            ** ble_phy_rssi_policy
+                            */
+#include "msg_queue.h"      /* msg_queue_default,
+                            ** msg_queue_lane_select_set,
+                            ** MSG_QUEUE_LANE_*
+                            */
+#include "run_loop.h"       /* RUN_LOOP_DEF, run_loop_init, run_loop_run,
+                            ** run_loop_init_t, run_loop_task_t,
+                            ** RUN_LOOP_EVT_*
+                            */
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// PHY manager of the link between the nodes.
+BLE_PHY_DEF(s_ble_phy);
+
+// Connection parameters tuner of the link between the nodes.
+BLE_CONN_TUNER_DEF(s_ble_conn_tuner);
+
+// Run loop of the node.
+RUN_LOOP_DEF(s_run_loop);
+
+/* Period of the tick serving the Luos timeouts and the periodic container
+** work, which need no finer resolution: the received messages wake the
+** module loops up through their events.
+*/
+#define LOOP_TICK_PERIOD_MS 10
+
+// Events of the link between the nodes: messages arrive in BLE events.
+#define LINK_EVTS           RUN_LOOP_EVT_BLE
+
+// Offset of the command in a Robus header, after the addressing fields.
+#define ROBUS_CMD_OFFSET    4
+
+// Module loops, in the order of the former main loop.
+static const run_loop_task_t LOOP_TASKS[] =
+{
+    { Luos_Loop,        LINK_EVTS | RUN_LOOP_EVT_TICK },
+    { LedToggler_Loop,  LINK_EVTS | RUN_LOOP_EVT_TICK },
+};
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Initializes the PHY manager: 2M PHY, falling back to 1M PHY when the
+** link gets weak.
+*/
+static void init_ble_phy(void);
+
+/* Sends the Luos protocol messages through the control lane of the HAL
+** sending queue, ahead of the container data.
+*/
+static void init_msg_queue(void);
+
+/* Initializes the connection parameters tuner, driven by the link
+** traffic and by the messages waiting in the HAL sending queue.
+*/
+static void init_ble_conn_tuner(void);
+
+/* Initializes the run loop: the module loops are called on the events
+** concerning them, and on each tick. The app_timer module is initialized
+** by the HAL.
+*/
+static void init_run_loop(void);
+
+/*      CALLBACKS                                                   */
+
+/* Returns the control lane for the Luos protocol messages (detection,
+** introduction, node identification...), the data lane otherwise.
+*/
+static msg_queue_lane_idx_t luos_lane_select(const uint8_t* data,
+                                             uint16_t size);
+
 int main(void)
 {
+    init_ble_phy();
+    init_msg_queue();
+    init_ble_conn_tuner();
+
     Luos_Init();
     LedToggler_Init();
 
-    while (true)
+    init_run_loop();
+    run_loop_run(&s_run_loop);
+}
+
+static void init_ble_phy(void)
+{
+    ble_phy_init_t params;
+    memset(&params, 0, sizeof(ble_phy_init_t));
+
+    params.preferred_phy    = BLE_GAP_PHY_2MBPS;
+    params.policy           = ble_phy_rssi_policy;
+
+    ble_phy_init(&s_ble_phy, &params);
+}
+
+static void init_msg_queue(void)
+{
+    msg_queue_lane_select_set(luos_lane_select);
+}
+
+static void init_ble_conn_tuner(void)
+{
+    ble_conn_tuner_init_t params;
+    memset(&params, 0, sizeof(ble_conn_tuner_init_t));
+
+    params.queue = msg_queue_default;
+
+    ble_conn_tuner_init(&s_ble_conn_tuner, &params);
+}
+
+static void init_run_loop(void)
+{
+    run_loop_init_t params;
+    memset(&params, 0, sizeof(run_loop_init_t));
+
+    params.tasks            = LOOP_TASKS;
+    params.nb_tasks         = sizeof(LOOP_TASKS) / sizeof(LOOP_TASKS[0]);
+    params.tick_period_ms   = LOOP_TICK_PERIOD_MS;
+
+    run_loop_init(&s_run_loop, &params);
+}
+
+static msg_queue_lane_idx_t luos_lane_select(const uint8_t* data,
+                                             uint16_t size)
+{
+    if ((size > ROBUS_CMD_OFFSET)
+        && (data[ROBUS_CMD_OFFSET] < LUOS_PROTOCOL_NB))
     {
-        Luos_Loop();
-        LedToggler_Loop();
+        return MSG_QUEUE_LANE_CONTROL;
     }
+
+    return MSG_QUEUE_LANE_DATA;
 }
@@ -2,25 +2,32 @@
 
 /*      INCLUDES                                                    */
 
+// C STANDARD
+#include <string.h>             // memset
+
 // NRF
 #include "ble_db_discovery.h"   // ble_db_discovery_evt_register
 #include "ble_gatt_db.h"        // ble_gatt_db_srv_t, ble_gatt_db_char_t
 #include "nrf_log.h"            // NRF_LOG_INFO
-#include "sdk_errors.h"         // ret_code_t
+#include "sdk_errors.h"         // ret_code_t, NRF_ERROR_*
 
 // NRF APPS
 #include "app_error.h"          // APP_ERROR_CHECK
 
 // SOFTDEVICE
 #include "ble.h"                // ble_evt_t
-#include "ble_gap.h"            // ble_gap_evt_t, BLE_GAP_EVT_*
-#include "ble_gatt.h"           // BLE_GATT_*
+#include "ble_err.h"            // BLE_ERROR_INVALID_CONN_HANDLE
+#include "ble_gap.h"            /* ble_gap_evt_t, BLE_GAP_EVT_*,
+                                ** BLE_GAP_ROLE_CENTRAL
+                                */
+#include "ble_gatt.h"           // BLE_GATT_*, BLE_GATT_STATUS_SUCCESS
 #include "ble_gattc.h"          /* ble_gattc_*, BLE_GATTC_EVT_*,
                                 ** sd_ble_gattc_write
                                 */
 #include "ble_types.h"          // ble_uuid_t, BLE_CONN_HANDLE_INVALID
 
 // CUSTOM
+#include "gatt_cache.h"         // gatt_cache_*, GATT_CACHE_HASH_INIT
 #include "ptp_service.h"        /* ptp_service_uuid_register,
                                 ** PTP_SERVICE_UUID, g_ptp_service_uuid
                                 */
@@ -30,21 +37,82 @@
 // Global PTP server UUID initialization.
 ble_uuid_t g_ptp_service_uuid;
 
+// Number of handles stored in the GATT cache: value, then CCCD.
+#define PTP_CLIENT_NB_CACHED_HANDLES    2
+
+// Hash of the PTP layout, key of the PTP handles in the GATT cache.
+static uint32_t s_db_hash;
+
 /*      STATIC FUNCTIONS                                            */
 
-// Stores the connection handle from the event in the given instance.
+// Initializes the GATT cache and computes the PTP layout hash.
+static void ptp_client_cache_init(void);
+
+/* Assigns the handles stored in the GATT cache for the server behind the
+** given link, and creates a PTP_C_DB_DISCOVERY_COMPLETE event. Does
+** nothing if there are none.
+*/
+static void ptp_client_cache_lookup(ptp_client_link_t* link,
+                                    ptp_client_t* instance);
+
+/* Hands the pending value of the given link to the SoftDevice. Keeps it
+** pending if the SoftDevice queue is full.
+*/
+static void ptp_client_write_flush(ptp_client_link_t* link);
+
+/* Writes the pending CCCD value of the given link. Keeps it pending if
+** another GATT client request is running.
+*/
+static void ptp_client_cccd_flush(ptp_client_link_t* link);
+
+// Calls the event handler of the given instance with the given event.
+static void ptp_client_evt_send(const ptp_client_evt_t* event,
+                                ptp_client_t* instance);
+
+// Resets the handles of the given link, and sets its connection handle.
+static void ptp_client_link_reset(ptp_client_link_t* link,
+                                  uint16_t conn_handle);
+
+/* Stores the connection handle and peer address from the event in a free
+** link of the given instance, and looks its handles up in the cache.
+*/
 static void ptp_client_on_connect_evt(const ble_gap_evt_t* event,
                                       ptp_client_t* instance);
 
-// Resets the given instance's connection handle.
-static void ptp_client_on_disconnect_evt(ptp_client_t* instance);
+// Frees the link of the given instance used by the given connection.
+static void ptp_client_on_disconnect_evt(const ble_gap_evt_t* event,
+                                         ptp_client_t* instance);
 
 /* Calls the notification callback of the given instance with the data
 ** from the given event.
 */
-static void ptp_client_on_hvx_evt(const ble_gattc_evt_hvx_t* event,
+static void ptp_client_on_hvx_evt(const ble_gattc_evt_t* event,
                                   ptp_client_t* instance);
 
+/* Releases the TX slots of the sent write commands, and sends the pending
+** value of the link.
+*/
+static void ptp_client_on_write_cmd_tx_complete_evt(
+    const ble_gattc_evt_t* event, ptp_client_t* instance);
+
+/* Creates a PTP_C_CCCD_WRITTEN event if the CCCD of the link was written.
+** If the server refused cached handles, forgets them and creates a
+** PTP_C_DB_CACHE_STALE event.
+*/
+static void ptp_client_on_write_rsp_evt(const ble_gattc_evt_t* event,
+                                        ptp_client_t* instance);
+
+/* Writes the pending CCCD value of the link of the given GATT client
+** response or timeout event: the previous request is over.
+*/
+static void ptp_client_on_gattc_rsp_evt(const ble_gattc_evt_t* event,
+                                        ptp_client_t* instance);
+
+/* Returns the connection handle of the first connected server of the
+** given instance, or BLE_CONN_HANDLE_INVALID if there is none.
+*/
+static uint16_t ptp_client_first_conn_handle(const ptp_client_t* instance);
+
 void ptp_client_init(ptp_client_t* instance,
                      const ptp_client_init_t* parameters)
 {
@@ -52,14 +120,19 @@ void ptp_client_init(ptp_client_t* instance,
     ptp_service_uuid_register(PTP_SERVICE_UUID, &g_ptp_service_uuid);
 
     // Initialize instance fields.
-    instance->evt_handler       = parameters->evt_handler;
-    instance->conn_handle       = BLE_CONN_HANDLE_INVALID;
-    instance->ptp_value_handle  = BLE_GATT_HANDLE_INVALID;
-    instance->ptp_cccd_handle   = BLE_GATT_HANDLE_INVALID;
+    instance->evt_handler = parameters->evt_handler;
+
+    for (uint8_t link_idx = 0; link_idx < PTP_CLIENT_MAX_LINKS; link_idx++)
+    {
+        ptp_client_link_reset(&(instance->links[link_idx]),
+                              BLE_CONN_HANDLE_INVALID);
+    }
 
     // Register in DB Discovery module.
     ret_code_t err_code = ble_db_discovery_evt_register(&g_ptp_service_uuid);
     APP_ERROR_CHECK(err_code);
+
+    ptp_client_cache_init();
 }
 
 void ptp_client_on_ble_evt(ble_evt_t const* event, void* context)
@@ -72,11 +145,26 @@ void ptp_client_on_ble_evt(ble_evt_t const* event, void* context)
         ptp_client_on_connect_evt(&(event->evt.gap_evt), instance);
         break;
     case BLE_GAP_EVT_DISCONNECTED:
-        ptp_client_on_disconnect_evt(instance);
+        ptp_client_on_disconnect_evt(&(event->evt.gap_evt), instance);
         break;
     case BLE_GATTC_EVT_HVX:
-        ptp_client_on_hvx_evt(&(event->evt.gattc_evt.params.hvx),
-                              instance);
+        ptp_client_on_hvx_evt(&(event->evt.gattc_evt), instance);
+        break;
+    case BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE:
+        ptp_client_on_write_cmd_tx_complete_evt(&(event->evt.gattc_evt),
+                                                instance);
+        break;
+    case BLE_GATTC_EVT_WRITE_RSP:
+        ptp_client_on_write_rsp_evt(&(event->evt.gattc_evt), instance);
+        ptp_client_on_gattc_rsp_evt(&(event->evt.gattc_evt), instance);
+        break;
+    case BLE_GATTC_EVT_PRIM_SRVC_DISC_RSP:
+    case BLE_GATTC_EVT_CHAR_DISC_RSP:
+    case BLE_GATTC_EVT_DESC_DISC_RSP:
+    case BLE_GATTC_EVT_READ_RSP:
+    case BLE_GATTC_EVT_EXCHANGE_MTU_RSP:
+    case BLE_GATTC_EVT_TIMEOUT:
+        ptp_client_on_gattc_rsp_evt(&(event->evt.gattc_evt), instance);
         break;
     default:
         break;
@@ -125,111 +213,456 @@ void ptp_client_on_db_discovery_evt(ble_db_discovery_evt_t* event,
     memset(&ptp_event, 0, sizeof(ptp_client_evt_t));
 
     ptp_event.evt_type          = PTP_C_DB_DISCOVERY_COMPLETE;
+    ptp_event.conn_handle       = event->conn_handle;
+    ptp_event.cached            = false;
     ptp_event.content.disc_db   = event_db;
 
-    if (instance->evt_handler != NULL)
+    ptp_client_link_t* link = ptp_client_link_get(instance,
+                                                  event->conn_handle);
+    if ((link != NULL)
+        && (event_db.ptp_value_handle != BLE_GATT_HANDLE_INVALID))
+    {
+        const uint16_t handles[PTP_CLIENT_NB_CACHED_HANDLES] =
+        {
+            event_db.ptp_value_handle,
+            event_db.ptp_cccd_handle,
+        };
+
+        gatt_cache_store(&(link->peer_addr), s_db_hash, handles,
+                         PTP_CLIENT_NB_CACHED_HANDLES);
+
+        link->cached = false;
+    }
+
+    ptp_client_evt_send(&ptp_event, instance);
+}
+
+void ptp_client_link_handles_assign(ptp_client_t* instance,
+                                    uint16_t conn_handle,
+                                    const ptp_client_db_t* ptp_db)
+{
+    ptp_client_link_t* link = ptp_client_link_get(instance, conn_handle);
+    if (link == NULL)
+    {
+        NRF_LOG_INFO("Unknown PTP server connection: leaving...");
+        return;
+    }
+
+    link->db = *ptp_db;
+
+    NRF_LOG_INFO("PTP characteristic handles assigned!");
+}
+
+void ptp_client_link_char_write(ptp_client_t* instance, uint16_t conn_handle,
+                                ptp_char_value_t val)
+{
+    ptp_client_link_t* link = ptp_client_link_get(instance, conn_handle);
+    if ((link == NULL)
+        || (link->db.ptp_value_handle == BLE_GATT_HANDLE_INVALID))
+    {
+        NRF_LOG_INFO("Value handle is not initialized: leaving...");
+        return;
+    }
+
+    if (link->write_pending)
+    {
+        // Still waiting for a TX slot: the older value is not sent.
+        link->pending_value = val;
+        link->write_stats.coalesced_count++;
+        return;
+    }
+
+    link->pending_value = val;
+    link->write_pending = true;
+
+    ptp_client_write_flush(link);
+}
+
+void ptp_client_link_notification_enable(ptp_client_t* instance,
+                                         uint16_t conn_handle, bool enable)
+{
+    ptp_client_link_t* link = ptp_client_link_get(instance, conn_handle);
+    if ((link == NULL)
+        || (link->db.ptp_cccd_handle == BLE_GATT_HANDLE_INVALID))
+    {
+        NRF_LOG_INFO("CCCD handle is not initialized: leaving...");
+        return;
+    }
+
+    if (enable)
     {
-        instance->evt_handler(&ptp_event, instance);
+        link->cccd_value = BLE_GATT_HVX_NOTIFICATION;
     }
     else
     {
-        NRF_LOG_INFO("No PTP event handler!");
+        link->cccd_value = BLE_GATT_HVX_INVALID;
     }
+
+    link->cccd_pending = true;
+
+    ptp_client_cccd_flush(link);
 }
 
 void ptp_client_handles_assign(ptp_client_t* instance,
                                const ptp_client_db_t* ptp_db)
 {
-    instance->ptp_value_handle  = ptp_db->ptp_value_handle;
-    instance->ptp_cccd_handle   = ptp_db->ptp_cccd_handle;
-
-    NRF_LOG_INFO("PTP characteristic handles assigned!");
+    ptp_client_link_handles_assign(instance,
+                                   ptp_client_first_conn_handle(instance),
+                                   ptp_db);
 }
 
 void ptp_client_ptp_char_write(ptp_client_t* instance,
                                ptp_char_value_t val)
 {
-    if (instance->ptp_value_handle == BLE_GATT_HANDLE_INVALID)
+    ptp_client_link_char_write(instance,
+                               ptp_client_first_conn_handle(instance), val);
+}
+
+void ptp_client_ptp_notification_enable(ptp_client_t* instance,
+                                        bool enable)
+{
+    ptp_client_link_notification_enable(instance,
+                                        ptp_client_first_conn_handle(instance),
+                                        enable);
+}
+
+ptp_client_link_t* ptp_client_link_get(ptp_client_t* instance,
+                                       uint16_t conn_handle)
+{
+    if (conn_handle == BLE_CONN_HANDLE_INVALID)
+    {
+        return NULL;
+    }
+
+    for (uint8_t link_idx = 0; link_idx < PTP_CLIENT_MAX_LINKS; link_idx++)
+    {
+        if (instance->links[link_idx].conn_handle == conn_handle)
+        {
+            return &(instance->links[link_idx]);
+        }
+    }
+
+    return NULL;
+}
+
+bool ptp_client_db_cached(ptp_client_t* instance, uint16_t conn_handle)
+{
+    ptp_client_link_t* link = ptp_client_link_get(instance, conn_handle);
+
+    return (link != NULL) && link->cached;
+}
+
+static void ptp_client_cache_init(void)
+{
+    const uint8_t   base_uuid[] = PTP_SERVICE_BASE_UUID;
+    const uint16_t  uuids[]     = { PTP_SERVICE_UUID, PTP_CHAR_UUID };
+
+    // The layout is the set of UUIDs looked for by the discovery.
+    s_db_hash = gatt_cache_hash(GATT_CACHE_HASH_INIT, base_uuid,
+                                sizeof(base_uuid));
+    s_db_hash = gatt_cache_hash(s_db_hash, uuids, sizeof(uuids));
+
+    gatt_cache_init();
+}
+
+static void ptp_client_cache_lookup(ptp_client_link_t* link,
+                                    ptp_client_t* instance)
+{
+    uint16_t handles[PTP_CLIENT_NB_CACHED_HANDLES];
+
+    if (!gatt_cache_find(&(link->peer_addr), s_db_hash, handles,
+                         PTP_CLIENT_NB_CACHED_HANDLES))
+    {
+        return;
+    }
+
+    link->cached = true;
+
+    ptp_client_evt_t ptp_event;
+    memset(&ptp_event, 0, sizeof(ptp_client_evt_t));
+
+    ptp_event.evt_type                          = PTP_C_DB_DISCOVERY_COMPLETE;
+    ptp_event.conn_handle                       = link->conn_handle;
+    ptp_event.cached                            = true;
+    ptp_event.content.disc_db.ptp_value_handle  = handles[0];
+    ptp_event.content.disc_db.ptp_cccd_handle   = handles[1];
+
+    NRF_LOG_INFO("PTP client: handles found in cache!");
+
+    ptp_client_evt_send(&ptp_event, instance);
+}
+
+static void ptp_client_write_flush(ptp_client_link_t* link)
+{
+    if (!link->write_pending)
     {
-        NRF_LOG_INFO("Value handle is not initialized: leaving...");
         return;
     }
 
     ble_gattc_write_params_t params;
     memset(&params, 0, sizeof(ble_gattc_write_params_t));
 
+    // Write commands are copied by the SoftDevice.
     params.write_op = BLE_GATT_OP_WRITE_CMD;
-    params.handle   = instance->ptp_value_handle;
+    params.handle   = link->db.ptp_value_handle;
     params.len      = sizeof(ptp_char_value_t);
-    params.p_value  = (uint8_t*)(&val);
+    params.p_value  = (uint8_t*)(&(link->pending_value));
 
-    ret_code_t err_code = sd_ble_gattc_write(instance->conn_handle,
-                                             &params);
-    APP_ERROR_CHECK(err_code);
+    ret_code_t err_code = sd_ble_gattc_write(link->conn_handle, &params);
+    switch (err_code)
+    {
+    case NRF_SUCCESS:
+        link->write_pending = false;
+        link->tx_outstanding++;
+        link->write_stats.sent_count++;
+        break;
+    case NRF_ERROR_RESOURCES:
+        // Sent on the next write command TX complete event.
+        link->write_stats.deferred_count++;
+        break;
+    case NRF_ERROR_INVALID_STATE:
+    case BLE_ERROR_INVALID_CONN_HANDLE:
+        // Disconnected: the value is dropped.
+        link->write_pending = false;
+        break;
+    default:
+        APP_ERROR_CHECK(err_code);
+        break;
+    }
 }
 
-void ptp_client_ptp_notification_enable(ptp_client_t* instance,
-                                        bool enable)
+static void ptp_client_cccd_flush(ptp_client_link_t* link)
 {
+    if (!link->cccd_pending)
+    {
+        return;
+    }
+
+    if (link->db.ptp_cccd_handle == BLE_GATT_HANDLE_INVALID)
+    {
+        // Handles forgotten meanwhile: the write is dropped.
+        link->cccd_pending = false;
+        return;
+    }
+
     ble_gattc_write_params_t params;
     memset(&params, 0, sizeof(ble_gattc_write_params_t));
 
-    uint8_t value;
-    if (enable)
+    // Acknowledged write: the response validates cached handles.
+    params.write_op = BLE_GATT_OP_WRITE_REQ;
+    params.handle   = link->db.ptp_cccd_handle;
+    params.len      = sizeof(link->cccd_value);
+    params.p_value  = &(link->cccd_value);
+
+    ret_code_t err_code = sd_ble_gattc_write(link->conn_handle, &params);
+    switch (err_code)
     {
-        value = BLE_GATT_HVX_NOTIFICATION;
+    case NRF_SUCCESS:
+        link->cccd_pending = false;
+        break;
+    case NRF_ERROR_BUSY:
+        // Written on the next GATT client response of the link.
+        NRF_LOG_INFO("PTP client: CCCD write deferred.");
+        break;
+    case NRF_ERROR_INVALID_STATE:
+    case BLE_ERROR_INVALID_CONN_HANDLE:
+        // Disconnected, or GATT timeout: the write is dropped.
+        link->cccd_pending = false;
+        break;
+    default:
+        APP_ERROR_CHECK(err_code);
+        break;
+    }
+}
+
+static void ptp_client_evt_send(const ptp_client_evt_t* event,
+                                ptp_client_t* instance)
+{
+    if (instance->evt_handler != NULL)
+    {
+        instance->evt_handler(event, instance);
     }
     else
     {
-        value = BLE_GATT_HVX_INVALID;
+        NRF_LOG_INFO("No PTP event handler!");
     }
+}
 
-    params.write_op = BLE_GATT_OP_WRITE_CMD;
-    params.handle   = instance->ptp_cccd_handle;
-    params.len      = sizeof(value);
-    params.p_value  = (uint8_t*)(&value);
-
-    ret_code_t err_code = sd_ble_gattc_write(instance->conn_handle,
-                                             &params);
-    APP_ERROR_CHECK(err_code);
+static void ptp_client_link_reset(ptp_client_link_t* link,
+                                  uint16_t conn_handle)
+{
+    link->conn_handle           = conn_handle;
+    link->db.ptp_value_handle   = BLE_GATT_HANDLE_INVALID;
+    link->db.ptp_cccd_handle    = BLE_GATT_HANDLE_INVALID;
+    link->cached                = false;
+    link->write_pending         = false;
+    link->tx_outstanding        = 0;
+    link->cccd_value            = BLE_GATT_HVX_INVALID;
+    link->cccd_pending          = false;
+
+    memset(&(link->peer_addr), 0, sizeof(ble_gap_addr_t));
+    memset(&(link->write_stats), 0, sizeof(ptp_client_write_stats_t));
 }
 
 static void ptp_client_on_connect_evt(const ble_gap_evt_t* event,
                                       ptp_client_t* instance)
 {
-    instance->conn_handle = event->conn_handle;
+    if (event->params.connected.role != BLE_GAP_ROLE_CENTRAL)
+    {
+        // Only servers are connected as peripherals.
+        return;
+    }
+
+    for (uint8_t link_idx = 0; link_idx < PTP_CLIENT_MAX_LINKS; link_idx++)
+    {
+        ptp_client_link_t* link = &(instance->links[link_idx]);
+
+        if (link->conn_handle == BLE_CONN_HANDLE_INVALID)
+        {
+            ptp_client_link_reset(link, event->conn_handle);
+            link->peer_addr = event->params.connected.peer_addr;
+
+            ptp_client_cache_lookup(link, instance);
+            return;
+        }
+    }
+
+    NRF_LOG_INFO("PTP client: No free link!");
 }
 
-static void ptp_client_on_disconnect_evt(ptp_client_t* instance)
+static void ptp_client_on_disconnect_evt(const ble_gap_evt_t* event,
+                                         ptp_client_t* instance)
 {
-    instance->conn_handle = BLE_CONN_HANDLE_INVALID;
+    ptp_client_link_t* link = ptp_client_link_get(instance,
+                                                  event->conn_handle);
+    if (link != NULL)
+    {
+        ptp_client_link_reset(link, BLE_CONN_HANDLE_INVALID);
+    }
 }
 
-static void ptp_client_on_hvx_evt(const ble_gattc_evt_hvx_t* event,
+static void ptp_client_on_hvx_evt(const ble_gattc_evt_t* event,
                                   ptp_client_t* instance)
 {
-    if (event->handle == instance->ptp_value_handle)
+    ptp_client_link_t* link = ptp_client_link_get(instance,
+                                                  event->conn_handle);
+    if (link == NULL)
     {
-        if (event->len != sizeof(ptp_char_value_t))
+        return;
+    }
+
+    const ble_gattc_evt_hvx_t* hvx = &(event->params.hvx);
+
+    if (hvx->handle == link->db.ptp_value_handle)
+    {
+        if (hvx->len != sizeof(ptp_char_value_t))
         {
             return;
         }
 
-        ptp_char_value_t* value_ptr = (ptp_char_value_t*)event->data;
+        ptp_char_value_t* value_ptr = (ptp_char_value_t*)hvx->data;
 
         ptp_client_evt_t ptp_evt;
         memset(&ptp_evt, 0, sizeof(ptp_client_evt_t));
 
         ptp_evt.evt_type        = PTP_C_NOTIFICATION_RECEIVED;
+        ptp_evt.conn_handle     = event->conn_handle;
+        ptp_evt.cached          = link->cached;
         ptp_evt.content.value   = *value_ptr;
 
-        if (instance->evt_handler != NULL)
-        {
-            instance->evt_handler(&ptp_evt, instance);
-        }
-        else
+        ptp_client_evt_send(&ptp_evt, instance);
+    }
+}
+
+static void ptp_client_on_write_cmd_tx_complete_evt(
+    const ble_gattc_evt_t* event, ptp_client_t* instance)
+{
+    ptp_client_link_t* link = ptp_client_link_get(instance,
+                                                  event->conn_handle);
+    if (link == NULL)
+    {
+        return;
+    }
+
+    // The count also covers the write commands of other modules.
+    uint8_t count = event->params.write_cmd_tx_complete.count;
+    if (count > link->tx_outstanding)
+    {
+        count = link->tx_outstanding;
+    }
+
+    link->tx_outstanding -= count;
+
+    ptp_client_write_flush(link);
+}
+
+static void ptp_client_on_write_rsp_evt(const ble_gattc_evt_t* event,
+                                        ptp_client_t* instance)
+{
+    ptp_client_link_t* link = ptp_client_link_get(instance,
+                                                  event->conn_handle);
+    if ((link == NULL)
+        || (event->params.write_rsp.handle != link->db.ptp_cccd_handle))
+    {
+        return;
+    }
+
+    ptp_client_evt_t ptp_evt;
+    memset(&ptp_evt, 0, sizeof(ptp_client_evt_t));
+
+    ptp_evt.conn_handle = event->conn_handle;
+    ptp_evt.cached      = link->cached;
+
+    if (event->gatt_status == BLE_GATT_STATUS_SUCCESS)
+    {
+        ptp_evt.evt_type = PTP_C_CCCD_WRITTEN;
+    }
+    else if (link->cached)
+    {
+        NRF_LOG_INFO("PTP client: cached handles refused: forgetting...");
+
+        gatt_cache_forget(&(link->peer_addr), s_db_hash);
+
+        link->db.ptp_value_handle   = BLE_GATT_HANDLE_INVALID;
+        link->db.ptp_cccd_handle    = BLE_GATT_HANDLE_INVALID;
+        link->cached                = false;
+
+        ptp_evt.evt_type = PTP_C_DB_CACHE_STALE;
+    }
+    else
+    {
+        NRF_LOG_INFO("PTP client: CCCD write failed (%u)!",
+                     event->gatt_status);
+        return;
+    }
+
+    ptp_client_evt_send(&ptp_evt, instance);
+}
+
+static void ptp_client_on_gattc_rsp_evt(const ble_gattc_evt_t* event,
+                                        ptp_client_t* instance)
+{
+    ptp_client_link_t* link = ptp_client_link_get(instance,
+                                                  event->conn_handle);
+    if (link == NULL)
+    {
+        return;
+    }
+
+    ptp_client_cccd_flush(link);
+}
+
+static uint16_t ptp_client_first_conn_handle(const ptp_client_t* instance)
+{
+    for (uint8_t link_idx = 0; link_idx < PTP_CLIENT_MAX_LINKS; link_idx++)
+    {
+        uint16_t conn_handle = instance->links[link_idx].conn_handle;
+
+        if (conn_handle != BLE_CONN_HANDLE_INVALID)
         {
-            NRF_LOG_INFO("No PTP event handler!");
+            return conn_handle;
         }
     }
+
+    return BLE_CONN_HANDLE_INVALID;
 }
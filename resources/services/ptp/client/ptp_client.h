@@ -14,6 +14,7 @@
 
 // SOFTDEVICE
 #include "ble.h"                // ble_evt_t
+#include "ble_gap.h"            // ble_gap_addr_t
 #include "ble_types.h"          // ble_uuid_t
 
 // CUSTOM
@@ -24,6 +25,9 @@
 // PTP client BLE observer priority.
 #define PTP_CLIENT_BLE_OBS_PRIO 3
 
+// Maximum number of PTP servers connected at once.
+#define PTP_CLIENT_MAX_LINKS    NRF_SDH_BLE_CENTRAL_LINK_COUNT
+
 // Defines a PTP client instance and assigns its BLE observer.
 #define PTP_CLIENT_DEF(_instance_name)                  \
     static ptp_client_t _instance_name;                 \
@@ -36,11 +40,21 @@
 // PTP client event type.
 typedef enum
 {
-    // Database discovery completed.
+    // Database discovery completed, or handles found in the GATT cache.
     PTP_C_DB_DISCOVERY_COMPLETE,
 
     // Notification received from server.
     PTP_C_NOTIFICATION_RECEIVED,
+
+    /* CCCD written on the server: notifications enabled or disabled as
+    ** requested. Once enabled, the link is ready.
+    */
+    PTP_C_CCCD_WRITTEN,
+
+    /* Cached handles refused by the server: the database discovery shall
+    ** be run.
+    */
+    PTP_C_DB_CACHE_STALE,
 } ptp_client_evt_type_t;
 
 // Result of a DB Discovery.
@@ -59,6 +73,12 @@ typedef struct
     // Event type.
     ptp_client_evt_type_t   evt_type;
 
+    // Connection handle of the server the event comes from.
+    uint16_t                conn_handle;
+
+    // True if the handles of the server come from the GATT cache.
+    bool                    cached;
+
     // Content of the event.
     union
     {
@@ -85,19 +105,58 @@ typedef struct
     ptp_client_evt_handler_t    evt_handler;
 } ptp_client_init_t;
 
-// PTP client instance.
-struct ptp_client_s
+// Statistics of the PTP value writes on a link.
+typedef struct
 {
-    // PTP server connection handle.
+    // Number of writes handed to the SoftDevice.
+    uint32_t    sent_count;
+
+    // Number of values replaced by a newer one before being sent.
+    uint32_t    coalesced_count;
+
+    // Number of times the SoftDevice queue was full.
+    uint32_t    deferred_count;
+} ptp_client_write_stats_t;
+
+// Connection to a PTP server.
+typedef struct
+{
+    // PTP server connection handle, or BLE_CONN_HANDLE_INVALID if unused.
     uint16_t                    conn_handle;
 
-    // FIXME Maybe these two fields could be put in a struct...
+    // PTP server address, key of its handles in the GATT cache.
+    ble_gap_addr_t              peer_addr;
+
+    // Handles of the PTP characteristic on this server.
+    ptp_client_db_t             db;
+
+    // True if the handles come from the GATT cache.
+    bool                        cached;
+
+    /* Value waiting for a free SoftDevice TX slot. Only the latest value
+    ** matters: a newer one replaces it.
+    */
+    ptp_char_value_t            pending_value;
+    bool                        write_pending;
 
-    // Value handle for the PTP characteristic.
-    uint16_t                    ptp_value_handle;
+    // Number of writes handed to the SoftDevice and not sent yet.
+    uint8_t                     tx_outstanding;
 
-    // CCCD handle for the PTP characteristic.
-    uint16_t                    ptp_cccd_handle;
+    /* CCCD value refused while another GATT client request was running:
+    ** written again on the next GATT client response of the link.
+    */
+    uint8_t                     cccd_value;
+    bool                        cccd_pending;
+
+    // Write statistics.
+    ptp_client_write_stats_t    write_stats;
+} ptp_client_link_t;
+
+// PTP client instance.
+struct ptp_client_s
+{
+    // Connections to the PTP servers.
+    ptp_client_link_t           links[PTP_CLIENT_MAX_LINKS];
 
     // Event handler for this instance.
     ptp_client_evt_handler_t    evt_handler;
@@ -107,32 +166,72 @@ struct ptp_client_s
 void ptp_client_init(ptp_client_t* instance,
                      const ptp_client_init_t* parameters);
 
-/* Connection:      Stores the connection handle.
-** Disconnection:   Resets the connection handle.
+/* Connection:      Stores the connection handle in a free link. If the
+**                  server handles are in the GATT cache, creates a
+**                  PTP_C_DB_DISCOVERY_COMPLETE event right away.
+** Disconnection:   Frees the link of the connection handle.
 ** Notification:    Creates a PTP_C_NOTIFICATION_RECEIVED event.
+** Write command sent:
+**                  Sends the pending value of the link, if any.
+** Write response:  Creates a PTP_C_CCCD_WRITTEN event if the CCCD was
+**                  written, or a PTP_C_DB_CACHE_STALE one if cached
+**                  handles were refused.
+** GATT client response or timeout:
+**                  Writes the pending CCCD value of the link, if any.
 */
 void ptp_client_on_ble_evt(ble_evt_t const* event, void* context);
 
 /* DB Discovery complete:   If conditions are met, retrieves required
-**                          handles.
+**                          handles and stores them in the GATT cache.
 */
 void ptp_client_on_db_discovery_evt(ble_db_discovery_evt_t* event,
                                     ptp_client_t* instance);
 
-/* Assigns the internal handles of the given instance with those present
-** in the given DB.
+/* Assigns the internal handles of the given instance for the given
+** connection with those present in the given DB.
+*/
+void ptp_client_link_handles_assign(ptp_client_t* instance,
+                                    uint16_t conn_handle,
+                                    const ptp_client_db_t* ptp_db);
+
+/* Writes the given value on the server behind the given connection of the
+** given instance. If the SoftDevice queue is full, the value is sent once
+** a write command is: a newer value written meanwhile replaces it.
+*/
+void ptp_client_link_char_write(ptp_client_t* instance, uint16_t conn_handle,
+                                ptp_char_value_t val);
+
+/* Enable notification for the PTP characteristic of the server behind the
+** given connection. The server acknowledges the write, which validates
+** cached handles. If another GATT client request is running, the write is
+** retried once it completes.
+*/
+void ptp_client_link_notification_enable(ptp_client_t* instance,
+                                         uint16_t conn_handle, bool enable);
+
+/* Single-link versions of the functions above: they act on the first
+** connected server of the given instance.
 */
 void ptp_client_handles_assign(ptp_client_t* instance,
                                const ptp_client_db_t* ptp_db);
 
-// Writes the given value on the server connected to the given instance.
 void ptp_client_ptp_char_write(ptp_client_t* instance,
                                ptp_char_value_t val);
 
-// Enable notification for the PTP characteristic.
 void ptp_client_ptp_notification_enable(ptp_client_t* instance,
                                         bool enable);
 
+/* Returns the link of the given instance for the given connection, or
+** NULL if the connection is not a PTP server one.
+*/
+ptp_client_link_t* ptp_client_link_get(ptp_client_t* instance,
+                                       uint16_t conn_handle);
+
+/* Returns true if the handles of the server behind the given connection
+** come from the GATT cache: its database discovery can be skipped.
+*/
+bool ptp_client_db_cached(ptp_client_t* instance, uint16_t conn_handle);
+
 // UUID of the PTP service.
 extern ble_uuid_t g_ptp_service_uuid;
 
@@ -8,17 +8,19 @@
 
 // NRF
 #include "nrf_log.h"        // NRF_LOG_INFO
-#include "sdk_errors.h"     // ret_code_t
+#include "sdk_errors.h"     // ret_code_t, NRF_ERROR_*
 
 // NRF APPS
 #include "app_error.h"      // APP_ERROR_CHECK
 
 // SOFTDEVICE
 #include "ble.h"            // ble_evt_t
-#include "ble_err.h"        // 
+#include "ble_err.h"        /* BLE_ERROR_GATTS_SYS_ATTR_MISSING,
+                            ** BLE_ERROR_INVALID_CONN_HANDLE
+                            */
 #include "ble_gap.h"        // BLE_GAP_EVT_*, ble_gap_evt_t
 #include "ble_gatts.h"      /* BLE_GATTS_SRVC_TYPE_PRIMARY,
-                            ** sd_ble_gatts_service_add,
+                            ** sd_ble_gatts_service_add, sd_ble_gatts_hvx,
                             ** ble_gatts_evt_write_t, BLE_GATTS_EVT_*
                             ** ble_gatts_attr_md_t, ble_gatts_attr_t,
                             ** ble_gatts_char_md_t,
@@ -77,9 +79,22 @@ static void ptp_service_register(ptp_server_t* instance);
 static void ptp_server_on_connect_evt(const ble_gap_evt_t* event,
                                       ptp_server_t* instance);
 
-// Resets the given instance's connection handle.
+/* Resets the given instance's connection handle, and drops its pending
+** value.
+*/
 static void ptp_server_on_disconnect_evt(ptp_server_t* instance);
 
+/* Releases the TX slots of the sent notifications, and sends the pending
+** value of the given instance.
+*/
+static void ptp_server_on_hvn_tx_complete_evt(const ble_gatts_evt_t* event,
+                                              ptp_server_t* instance);
+
+/* Hands the pending value of the given instance to the SoftDevice. Keeps
+** it pending if the SoftDevice queue is full.
+*/
+static void ptp_server_notif_flush(ptp_server_t* instance);
+
 /* Calls the write callback of the given instance with the data from the
 ** given event.
 */
@@ -98,6 +113,10 @@ void ptp_server_init(ptp_server_t* instance,
     // Set instance fields.
     instance->ptp_write_evt_handler = parameters->ptp_write_evt_handler;
     instance->conn_handle           = BLE_CONN_HANDLE_INVALID;
+    instance->notif_pending         = false;
+    instance->tx_outstanding        = 0;
+
+    memset(&(instance->notif_stats), 0, sizeof(ptp_server_notif_stats_t));
 
     // Register service in BLE stack.
     ptp_service_register(instance);
@@ -122,6 +141,10 @@ void ptp_server_on_ble_evt(ble_evt_t const* event, void* context)
         ptp_server_on_write_evt(&(event->evt.gatts_evt.params.write),
                                 instance);
         break;
+    case BLE_GATTS_EVT_HVN_TX_COMPLETE:
+        ptp_server_on_hvn_tx_complete_evt(&(event->evt.gatts_evt),
+                                          instance);
+        break;
     default:
         break;
     }
@@ -133,31 +156,22 @@ void ptp_server_on_ptp_update(ptp_server_t* instance,
     if (instance->conn_handle == BLE_CONN_HANDLE_INVALID)
     {
         NRF_LOG_INFO("Connection handle not assigned: leaving...");
+        instance->notif_stats.dropped_count++;
         return;
     }
 
-    ble_gatts_hvx_params_t params;
-    memset(&params, 0, sizeof(ble_gatts_hvx_params_t));
-
-    uint16_t len = sizeof(ptp_char_value_t);
-
-    params.handle   = instance->ptp_char_handles.value_handle;
-    params.type     = BLE_GATT_HVX_NOTIFICATION;
-    params.p_len    = &len;
-    params.p_data   = (uint8_t*)(&value);
-
-    ret_code_t err_code = sd_ble_gatts_hvx(instance->conn_handle,
-                                           &params);
-    if (err_code == BLE_ERROR_GATTS_SYS_ATTR_MISSING)
+    if (instance->notif_pending)
     {
-        NRF_LOG_INFO("CCCD not configured yet: leaving...");
+        // Still waiting for a TX slot: the older value is not sent.
+        instance->pending_value = value;
+        instance->notif_stats.merged_count++;
         return;
     }
-    APP_ERROR_CHECK(err_code);
 
-    /* Exit after here: since len is only one byte, we assume everything
-    ** was sent.
-    */
+    instance->pending_value = value;
+    instance->notif_pending = true;
+
+    ptp_server_notif_flush(instance);
 }
 
 static void ptp_service_register(ptp_server_t* instance)
@@ -170,12 +184,87 @@ static void ptp_service_register(ptp_server_t* instance)
 static void ptp_server_on_connect_evt(const ble_gap_evt_t* event,
                                       ptp_server_t* instance)
 {
-    instance->conn_handle = event->conn_handle;
+    instance->conn_handle       = event->conn_handle;
+    instance->notif_pending     = false;
+    instance->tx_outstanding    = 0;
 }
 
 static void ptp_server_on_disconnect_evt(ptp_server_t* instance)
 {
     instance->conn_handle = BLE_CONN_HANDLE_INVALID;
+
+    if (instance->notif_pending)
+    {
+        instance->notif_pending = false;
+        instance->notif_stats.dropped_count++;
+    }
+
+    instance->tx_outstanding = 0;
+}
+
+static void ptp_server_on_hvn_tx_complete_evt(const ble_gatts_evt_t* event,
+                                              ptp_server_t* instance)
+{
+    if (event->conn_handle != instance->conn_handle)
+    {
+        return;
+    }
+
+    // The count also covers the notifications of other services.
+    uint8_t count = event->params.hvn_tx_complete.count;
+    if (count > instance->tx_outstanding)
+    {
+        count = instance->tx_outstanding;
+    }
+
+    instance->tx_outstanding -= count;
+
+    ptp_server_notif_flush(instance);
+}
+
+static void ptp_server_notif_flush(ptp_server_t* instance)
+{
+    if (!instance->notif_pending)
+    {
+        return;
+    }
+
+    ble_gatts_hvx_params_t params;
+    memset(&params, 0, sizeof(ble_gatts_hvx_params_t));
+
+    uint16_t len = sizeof(ptp_char_value_t);
+
+    // Notifications are copied by the SoftDevice.
+    params.handle   = instance->ptp_char_handles.value_handle;
+    params.type     = BLE_GATT_HVX_NOTIFICATION;
+    params.p_len    = &len;
+    params.p_data   = (uint8_t*)(&(instance->pending_value));
+
+    ret_code_t err_code = sd_ble_gatts_hvx(instance->conn_handle,
+                                           &params);
+    switch (err_code)
+    {
+    case NRF_SUCCESS:
+        instance->notif_pending = false;
+        instance->tx_outstanding++;
+        instance->notif_stats.sent_count++;
+        break;
+    case NRF_ERROR_RESOURCES:
+        // Sent on the next notification TX complete event.
+        instance->notif_stats.deferred_count++;
+        break;
+    case BLE_ERROR_GATTS_SYS_ATTR_MISSING:
+    case NRF_ERROR_INVALID_STATE:
+    case BLE_ERROR_INVALID_CONN_HANDLE:
+        // CCCD not configured yet, or disconnected: the value is dropped.
+        NRF_LOG_INFO("Notifications not enabled: leaving...");
+        instance->notif_pending = false;
+        instance->notif_stats.dropped_count++;
+        break;
+    default:
+        APP_ERROR_CHECK(err_code);
+        break;
+    }
 }
 
 static void ptp_server_on_write_evt(const ble_gatts_evt_write_t* event,
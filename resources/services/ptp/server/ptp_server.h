@@ -4,7 +4,8 @@
 /*      INCLUDES                                                    */
 
 // C STANDARD
-#include <stdint.h>         // uint16_t
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
 
 // NRF
 #include "nrf_sdh_ble.h"    // NRF_SDH_BLE_OBSERVER
@@ -45,6 +46,24 @@ typedef struct
 
 } ptp_server_init_t;
 
+// Statistics of the PTP notifications.
+typedef struct
+{
+    // Number of notifications handed to the SoftDevice.
+    uint32_t    sent_count;
+
+    // Number of values replaced by a newer one before being sent.
+    uint32_t    merged_count;
+
+    // Number of times the SoftDevice queue was full.
+    uint32_t    deferred_count;
+
+    /* Number of values not sent: no connection, notifications disabled,
+    ** or disconnection while pending.
+    */
+    uint32_t    dropped_count;
+} ptp_server_notif_stats_t;
+
 // PTP server instance.
 struct ptp_server_s
 {
@@ -60,6 +79,17 @@ struct ptp_server_s
     // Callback for write event on PTP characteristic.
     ptp_server_ptp_write_evt_handler_t  ptp_write_evt_handler;
 
+    /* Value waiting for a free SoftDevice TX slot. Only the latest value
+    ** matters: a newer one replaces it.
+    */
+    ptp_char_value_t                    pending_value;
+    bool                                notif_pending;
+
+    // Number of notifications handed to the SoftDevice and not sent yet.
+    uint8_t                             tx_outstanding;
+
+    // Notification statistics.
+    ptp_server_notif_stats_t            notif_stats;
 };
 
 // Initializes the given PTP server instance with the given parameters.
@@ -67,12 +97,18 @@ void ptp_server_init(ptp_server_t* instance,
                      const ptp_server_init_t* parameters);
 
 /* Connection:      Stores the connection handle.
-** Disconnection:   Resets the connection handle.
+** Disconnection:   Resets the connection handle, and drops the pending
+**                  value.
 ** Write event:     Calls the stored callback.
+** Notification sent:
+**                  Sends the pending value, if any.
 */
 void ptp_server_on_ble_evt(ble_evt_t const* event, void* context);
 
-// Notifies the PTP client on PTP characteristic update.
+/* Notifies the PTP client on PTP characteristic update. If the SoftDevice
+** queue is full, the value is sent once a notification is: a newer value
+** notified meanwhile replaces it.
+*/
 void ptp_server_on_ptp_update(ptp_server_t* instance,
                               ptp_char_value_t value);
 
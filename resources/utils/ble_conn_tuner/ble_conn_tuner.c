@@ -0,0 +1,418 @@
+#include "ble_conn_tuner.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdatomic.h>          // atomic_*
+#include <stddef.h>             // NULL
+#include <string.h>             // memset
+
+// NRF
+#include "nrf_log.h"            // NRF_LOG_INFO
+#include "sdk_common.h"         // NRF_MODULE_ENABLED
+#include "sdk_errors.h"         // ret_code_t, NRF_ERROR_*
+
+#if NRF_MODULE_ENABLED(NRF_BLE_CONN_PARAMS)
+#include "ble_conn_params.h"    // ble_conn_params_change_conn_params
+#endif /* NRF_MODULE_ENABLED(NRF_BLE_CONN_PARAMS) */
+
+// NRF APPS
+#include "app_error.h"          // APP_ERROR_CHECK
+#include "app_timer.h"          // app_timer_*, APP_TIMER_*
+#include "app_util.h"           // MSEC_TO_UNITS, UNIT_*
+
+// SOFTDEVICE
+#include "ble_gap.h"            /* ble_gap_*, sd_ble_gap_conn_param_update,
+                                ** BLE_GAP_EVT_*, BLE_GAP_ROLE_CENTRAL
+                                */
+#include "ble_gattc.h"          // BLE_GATTC_EVT_*
+#include "ble_gatts.h"          // BLE_GATTS_EVT_*
+#include "ble_types.h"          // BLE_CONN_HANDLE_INVALID
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Connection intervals, in 1.25 ms units.
+#define BUSY_INTERVAL   MSEC_TO_UNITS(BLE_CONN_TUNER_BUSY_INTERVAL_MS,     \
+                                      UNIT_1_25_MS)
+#define IDLE_INTERVAL   MSEC_TO_UNITS(BLE_CONN_TUNER_IDLE_INTERVAL_MS,     \
+                                      UNIT_1_25_MS)
+
+// Supervision timeout, in 10 ms units.
+#define SUP_TIMEOUT     MSEC_TO_UNITS(BLE_CONN_TUNER_SUP_TIMEOUT_MS,       \
+                                      UNIT_10_MS)
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Assigns a free link of the given instance to the connection from the
+** event, enables event length extension and starts sampling.
+*/
+static void ble_conn_tuner_on_connect_evt(const ble_gap_evt_t* event,
+                                          ble_conn_tuner_t* instance);
+
+/* Frees the given link, and stops sampling if no link of the given
+** instance is left.
+*/
+static void ble_conn_tuner_on_disconnect_evt(ble_conn_tuner_t* instance,
+                                             ble_conn_tuner_link_t* link);
+
+// Adds the given number of packets to the traffic of the current sample.
+static void ble_conn_tuner_packets_count(ble_conn_tuner_link_t* link,
+                                         uint16_t nb_packets);
+
+/* Requests the short interval on the given link if the given value is
+** true, the long one otherwise.
+*/
+static void ble_conn_tuner_params_update(ble_conn_tuner_link_t* link,
+                                         bool busy);
+
+/* Updates the local traffic state of the given link from its sampled
+** traffic, and updates its connection parameters if the wanted ones
+** changed or if the peer is waiting for an answer.
+*/
+static void ble_conn_tuner_link_sample(ble_conn_tuner_link_t* link);
+
+/* Accepts the parameters requested by the peer on a connection which is
+** not tuned, as all links are in use.
+*/
+static void ble_conn_tuner_on_other_update_request_evt(
+    const ble_gap_evt_t* event);
+
+/*      CALLBACKS                                                   */
+
+// Samples the connected links of the instance given as context.
+static void ble_conn_tuner_sample(void* context);
+
+void ble_conn_tuner_init(ble_conn_tuner_t* instance,
+                         const ble_conn_tuner_init_t* parameters)
+{
+    memset(instance, 0, sizeof(ble_conn_tuner_t));
+
+    instance->queue     = parameters->queue;
+    instance->timer_id  = &(instance->timer_data);
+
+    for (uint8_t link_idx = 0; link_idx < BLE_CONN_TUNER_MAX_LINKS;
+         link_idx++)
+    {
+        instance->links[link_idx].conn_handle = BLE_CONN_HANDLE_INVALID;
+    }
+}
+
+void ble_conn_tuner_on_ble_evt(ble_evt_t const* event, void* context)
+{
+    ble_conn_tuner_t* instance = (ble_conn_tuner_t*)context;
+
+    if (event->header.evt_id == BLE_GAP_EVT_CONNECTED)
+    {
+        ble_conn_tuner_on_connect_evt(&(event->evt.gap_evt), instance);
+        return;
+    }
+
+    // All connection events start with their connection handle.
+    ble_conn_tuner_link_t* link = ble_conn_tuner_link_get(instance,
+        event->evt.gap_evt.conn_handle);
+    if (link == NULL)
+    {
+        if (event->header.evt_id == BLE_GAP_EVT_CONN_PARAM_UPDATE_REQUEST)
+        {
+            ble_conn_tuner_on_other_update_request_evt(
+                &(event->evt.gap_evt));
+        }
+
+        return;
+    }
+
+    switch (event->header.evt_id)
+    {
+    case BLE_GAP_EVT_DISCONNECTED:
+        ble_conn_tuner_on_disconnect_evt(instance, link);
+        break;
+    case BLE_GAP_EVT_CONN_PARAM_UPDATE_REQUEST:
+    {
+        const ble_gap_conn_params_t* params =
+            &(event->evt.gap_evt.params.conn_param_update_request
+              .conn_params);
+
+        link->peer_busy         = (params->max_conn_interval
+                                   < IDLE_INTERVAL);
+        link->update_pending    = true;
+    }
+        break;
+    case BLE_GAP_EVT_CONN_PARAM_UPDATE:
+        link->stats.interval = event->evt.gap_evt.params.conn_param_update
+                               .conn_params.max_conn_interval;
+        link->stats.update_count++;
+
+        #ifdef DEBUG
+        NRF_LOG_INFO("Connection interval on %u: %u units!",
+                     link->conn_handle, link->stats.interval);
+        #endif /* DEBUG */
+        break;
+    case BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE:
+        ble_conn_tuner_packets_count(link,
+            event->evt.gattc_evt.params.write_cmd_tx_complete.count);
+        break;
+    case BLE_GATTS_EVT_HVN_TX_COMPLETE:
+        ble_conn_tuner_packets_count(link,
+            event->evt.gatts_evt.params.hvn_tx_complete.count);
+        break;
+    case BLE_GATTC_EVT_HVX:
+    case BLE_GATTS_EVT_WRITE:
+        ble_conn_tuner_packets_count(link, 1);
+        break;
+    default:
+        break;
+    }
+}
+
+ble_conn_tuner_link_t* ble_conn_tuner_link_get(ble_conn_tuner_t* instance,
+                                               uint16_t conn_handle)
+{
+    if (conn_handle == BLE_CONN_HANDLE_INVALID)
+    {
+        return NULL;
+    }
+
+    for (uint8_t link_idx = 0; link_idx < BLE_CONN_TUNER_MAX_LINKS;
+         link_idx++)
+    {
+        if (instance->links[link_idx].conn_handle == conn_handle)
+        {
+            return &(instance->links[link_idx]);
+        }
+    }
+
+    return NULL;
+}
+
+bool ble_conn_tuner_link_queue_set(ble_conn_tuner_t* instance,
+                                   uint16_t conn_handle,
+                                   const msg_queue_t* queue)
+{
+    ble_conn_tuner_link_t* link = ble_conn_tuner_link_get(instance,
+                                                          conn_handle);
+    if (link == NULL)
+    {
+        return false;
+    }
+
+    link->queue = queue;
+
+    return true;
+}
+
+static void ble_conn_tuner_on_connect_evt(const ble_gap_evt_t* event,
+                                          ble_conn_tuner_t* instance)
+{
+    ble_conn_tuner_link_t* link = NULL;
+    bool first_link             = true;
+
+    for (uint8_t link_idx = 0; link_idx < BLE_CONN_TUNER_MAX_LINKS;
+         link_idx++)
+    {
+        ble_conn_tuner_link_t* other = &(instance->links[link_idx]);
+
+        if (other->conn_handle != BLE_CONN_HANDLE_INVALID)
+        {
+            first_link = false;
+        }
+        else if (link == NULL)
+        {
+            link = other;
+        }
+    }
+
+    if (link == NULL)
+    {
+        // More connections than links: this one keeps the peer's choice.
+        return;
+    }
+
+    memset(&(link->stats), 0, sizeof(ble_conn_tuner_stats_t));
+
+    link->conn_handle       = event->conn_handle;
+    link->central           = (event->params.connected.role
+                               == BLE_GAP_ROLE_CENTRAL);
+    link->queue             = instance->queue;
+    link->stats.interval    = event->params.connected.conn_params
+                              .max_conn_interval;
+
+    // Connection setup is busy: relax only once it is over.
+    link->local_busy        = true;
+    link->peer_busy         = false;
+    link->busy              = (link->stats.interval <= BUSY_INTERVAL);
+    link->update_pending    = false;
+    link->nb_quiet_samples  = 0;
+    atomic_store(&(link->nb_packets), 0);
+
+    ble_opt_t opt;
+    memset(&opt, 0, sizeof(ble_opt_t));
+
+    opt.common_opt.conn_evt_ext.enable = 1;
+
+    ret_code_t err_code = sd_ble_opt_set(BLE_COMMON_OPT_CONN_EVT_EXT, &opt);
+    APP_ERROR_CHECK(err_code);
+
+    if (!first_link)
+    {
+        // Already sampling.
+        return;
+    }
+
+    err_code = app_timer_create(&(instance->timer_id),
+                                APP_TIMER_MODE_REPEATED,
+                                ble_conn_tuner_sample);
+    APP_ERROR_CHECK(err_code);
+
+    err_code = app_timer_start(instance->timer_id,
+                               APP_TIMER_TICKS(
+                                   BLE_CONN_TUNER_SAMPLE_PERIOD_MS),
+                               instance);
+    APP_ERROR_CHECK(err_code);
+}
+
+static void ble_conn_tuner_on_disconnect_evt(ble_conn_tuner_t* instance,
+                                             ble_conn_tuner_link_t* link)
+{
+    link->conn_handle = BLE_CONN_HANDLE_INVALID;
+
+    for (uint8_t link_idx = 0; link_idx < BLE_CONN_TUNER_MAX_LINKS;
+         link_idx++)
+    {
+        if (instance->links[link_idx].conn_handle != BLE_CONN_HANDLE_INVALID)
+        {
+            // Other links still need sampling.
+            return;
+        }
+    }
+
+    ret_code_t err_code = app_timer_stop(instance->timer_id);
+    APP_ERROR_CHECK(err_code);
+}
+
+static void ble_conn_tuner_packets_count(ble_conn_tuner_link_t* link,
+                                         uint16_t nb_packets)
+{
+    atomic_fetch_add(&(link->nb_packets), nb_packets);
+}
+
+static void ble_conn_tuner_params_update(ble_conn_tuner_link_t* link,
+                                         bool busy)
+{
+    ble_gap_conn_params_t params;
+    memset(&params, 0, sizeof(ble_gap_conn_params_t));
+
+    /* A relaxing peripheral accepts any interval up to the long one, so
+    ** that its central may keep the short one for its own traffic.
+    */
+    params.min_conn_interval    = (busy || !link->central)
+                                  ? BUSY_INTERVAL : IDLE_INTERVAL;
+    params.max_conn_interval    = busy ? BUSY_INTERVAL : IDLE_INTERVAL;
+    params.slave_latency        = 0;
+    params.conn_sup_timeout     = SUP_TIMEOUT;
+
+    ret_code_t err_code;
+
+    #if NRF_MODULE_ENABLED(NRF_BLE_CONN_PARAMS)
+    if (!link->central)
+    {
+        /* The connection parameters module would renegotiate parameters
+        ** outside of its preferred ones: change them there.
+        */
+        err_code = ble_conn_params_change_conn_params(link->conn_handle,
+                                                      &params);
+    }
+    else
+    #endif /* NRF_MODULE_ENABLED(NRF_BLE_CONN_PARAMS) */
+    {
+        err_code = sd_ble_gap_conn_param_update(link->conn_handle, &params);
+    }
+
+    switch (err_code)
+    {
+    case NRF_SUCCESS:
+        link->busy              = busy;
+        link->update_pending    = false;
+        break;
+    case NRF_ERROR_BUSY:
+        // A procedure is ongoing: try again at the next sample.
+        link->update_pending    = true;
+        break;
+    case NRF_ERROR_INVALID_STATE:
+        // Disconnected, or request already answered by another module.
+        link->update_pending    = false;
+        break;
+    default:
+        APP_ERROR_CHECK(err_code);
+        break;
+    }
+}
+
+static void ble_conn_tuner_link_sample(ble_conn_tuner_link_t* link)
+{
+    uint16_t nb_packets = atomic_exchange(&(link->nb_packets), 0);
+
+    uint16_t backlog = 0;
+    if (link->queue != NULL)
+    {
+        backlog = msg_queue_inst_count(link->queue);
+    }
+
+    if ((nb_packets >= BLE_CONN_TUNER_BUSY_PACKETS)
+        || (backlog >= BLE_CONN_TUNER_BUSY_BACKLOG))
+    {
+        link->local_busy        = true;
+        link->nb_quiet_samples  = 0;
+    }
+    else if (link->local_busy)
+    {
+        link->nb_quiet_samples++;
+        if (link->nb_quiet_samples >= BLE_CONN_TUNER_IDLE_SAMPLES)
+        {
+            link->local_busy = false;
+        }
+    }
+
+    if (link->busy)
+    {
+        link->stats.busy_samples++;
+    }
+    else
+    {
+        link->stats.idle_samples++;
+    }
+
+    // A central serves its peer's traffic too.
+    bool busy = link->local_busy || (link->central && link->peer_busy);
+
+    if ((busy != link->busy) || link->update_pending)
+    {
+        ble_conn_tuner_params_update(link, busy);
+    }
+}
+
+static void ble_conn_tuner_on_other_update_request_evt(
+    const ble_gap_evt_t* event)
+{
+    ret_code_t err_code = sd_ble_gap_conn_param_update(event->conn_handle,
+        &(event->params.conn_param_update_request.conn_params));
+    if ((err_code != NRF_ERROR_BUSY) && (err_code != NRF_ERROR_INVALID_STATE))
+    {
+        APP_ERROR_CHECK(err_code);
+    }
+}
+
+static void ble_conn_tuner_sample(void* context)
+{
+    ble_conn_tuner_t* instance = (ble_conn_tuner_t*)context;
+
+    for (uint8_t link_idx = 0; link_idx < BLE_CONN_TUNER_MAX_LINKS;
+         link_idx++)
+    {
+        ble_conn_tuner_link_t* link = &(instance->links[link_idx]);
+
+        if (link->conn_handle != BLE_CONN_HANDLE_INVALID)
+        {
+            ble_conn_tuner_link_sample(link);
+        }
+    }
+}
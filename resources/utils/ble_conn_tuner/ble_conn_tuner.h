@@ -0,0 +1,174 @@
+#ifndef BLE_CONN_TUNER_H
+#define BLE_CONN_TUNER_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdatomic.h>      // _Atomic
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+
+// NRF
+#include "nrf_sdh_ble.h"    // NRF_SDH_BLE_OBSERVER
+
+// NRF APPS
+#include "app_timer.h"      // app_timer_t, app_timer_id_t
+
+// SOFTDEVICE
+#include "ble.h"            // ble_evt_t
+
+// CUSTOM
+#include "msg_queue.h"      // msg_queue_t
+
+/*      CONSTANTS                                                   */
+
+/* The tuner keeps each link on a short connection interval while there
+** is traffic to carry, and relaxes it to a long one once the link has
+** been quiet for a while. Connection event length extension is enabled,
+** so that a busy link can use each whole interval.
+**
+** Traffic is measured as the number of packets sent and received, and,
+** if a sending queue is given, as the number of messages waiting in it.
+** A peripheral requests the parameters it wants; a central applies the
+** short interval whenever itself or its peer wants it.
+*/
+
+// Maximum number of links tuned at once.
+#define BLE_CONN_TUNER_MAX_LINKS            NRF_SDH_BLE_TOTAL_LINK_COUNT
+
+// Connection tuner BLE observer priority.
+#define BLE_CONN_TUNER_BLE_OBS_PRIO         2
+
+// Period at which the traffic is sampled.
+#define BLE_CONN_TUNER_SAMPLE_PERIOD_MS     200
+
+/* Number of packets per sample, or of messages waiting in the queue,
+** from which the link is considered busy.
+*/
+#define BLE_CONN_TUNER_BUSY_PACKETS         8
+#define BLE_CONN_TUNER_BUSY_BACKLOG         2
+
+// Number of quiet samples in a row before the link is relaxed.
+#define BLE_CONN_TUNER_IDLE_SAMPLES         5
+
+// Connection interval while busy and while idle.
+#define BLE_CONN_TUNER_BUSY_INTERVAL_MS     7.5
+#define BLE_CONN_TUNER_IDLE_INTERVAL_MS     100
+
+// Supervision timeout, the same for both intervals.
+#define BLE_CONN_TUNER_SUP_TIMEOUT_MS       4000
+
+// Defines a connection tuner instance and assigns its BLE observer.
+#define BLE_CONN_TUNER_DEF(_instance_name)              \
+    static ble_conn_tuner_t _instance_name;             \
+    NRF_SDH_BLE_OBSERVER(_instance_name ## _ble_obs,    \
+        BLE_CONN_TUNER_BLE_OBS_PRIO,                    \
+        ble_conn_tuner_on_ble_evt,                      \
+        &_instance_name                                 \
+    )/*;*/
+
+// Parameters needed to initialize a connection tuner instance.
+typedef struct
+{
+    /* Queue of the messages to send, or NULL if unknown. Used by every
+    ** link, unless given its own with ble_conn_tuner_link_queue_set.
+    */
+    const msg_queue_t*  queue;
+} ble_conn_tuner_init_t;
+
+// Statistics of a link tuned by a connection tuner.
+typedef struct
+{
+    // Number of samples taken while the link was busy and idle.
+    uint32_t    busy_samples;
+    uint32_t    idle_samples;
+
+    // Number of completed connection parameters updates.
+    uint32_t    update_count;
+
+    // Current connection interval, in 1.25 ms units.
+    uint16_t    interval;
+} ble_conn_tuner_stats_t;
+
+// Link tuned by a connection tuner.
+typedef struct
+{
+    // Connection handle, or BLE_CONN_HANDLE_INVALID if unused.
+    uint16_t                conn_handle;
+
+    // True if the local device is the central of the connection.
+    bool                    central;
+
+    // Queue of the messages to send on the link, or NULL if unknown.
+    const msg_queue_t*      queue;
+
+    // Packets sent and received since the last sample.
+    _Atomic uint16_t        nb_packets;
+
+    // Quiet samples in a row.
+    uint8_t                 nb_quiet_samples;
+
+    // True if the local traffic needs the short interval.
+    bool                    local_busy;
+
+    // True if the peer last requested the short interval.
+    bool                    peer_busy;
+
+    // True if the link is currently set up for the short interval.
+    bool                    busy;
+
+    // True if an update could not be sent while a procedure was ongoing.
+    bool                    update_pending;
+
+    // Statistics.
+    ble_conn_tuner_stats_t  stats;
+} ble_conn_tuner_link_t;
+
+// Connection tuner instance.
+typedef struct
+{
+    // Queue given to the links on connection, or NULL if unknown.
+    const msg_queue_t*      queue;
+
+    // Tuned links.
+    ble_conn_tuner_link_t   links[BLE_CONN_TUNER_MAX_LINKS];
+
+    // Sampling timer, running while a link is connected.
+    app_timer_t             timer_data;
+    app_timer_id_t          timer_id;
+} ble_conn_tuner_t;
+
+/* Initializes the given connection tuner instance with the given
+** parameters. Sampling starts on connection: the app_timer module shall
+** be initialized by then.
+*/
+void ble_conn_tuner_init(ble_conn_tuner_t* instance,
+                         const ble_conn_tuner_init_t* parameters);
+
+/* Connection:              Assigns a free link, enables event length
+**                          extension, and starts sampling.
+** Disconnection:           Frees the link, and stops sampling if it was
+**                          the last one.
+** Params update request:   Stores what the peer wants, and applies the
+**                          resulting parameters.
+** Params update:           Stores the new interval, and sends the
+**                          pending update.
+** Packets sent/received:   Counts them.
+** Each connection is tuned on its own link.
+*/
+void ble_conn_tuner_on_ble_evt(ble_evt_t const* event, void* context);
+
+/* Returns the link of the given instance for the given connection, or
+** NULL if the connection is not tuned.
+*/
+ble_conn_tuner_link_t* ble_conn_tuner_link_get(ble_conn_tuner_t* instance,
+                                               uint16_t conn_handle);
+
+/* Sets the queue of the messages to send on the given connection, or NULL
+** if unknown. Returns false if the connection is not tuned.
+*/
+bool ble_conn_tuner_link_queue_set(ble_conn_tuner_t* instance,
+                                   uint16_t conn_handle,
+                                   const msg_queue_t* queue);
+
+#endif /* ! BLE_CONN_TUNER_H */
@@ -0,0 +1,455 @@
+#include "ble_l2cap_ch.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stddef.h>             // NULL
+#include <string.h>             // memset
+
+// NRF
+#include "nrf_log.h"            // NRF_LOG_INFO
+#include "sdk_errors.h"         // ret_code_t, NRF_ERROR_*
+
+// NRF APPS
+#include "app_error.h"          // APP_ERROR_CHECK
+#include "app_util_platform.h"  // CRITICAL_REGION_*
+
+// SOFTDEVICE
+#include "ble_gap.h"            // BLE_GAP_EVT_*, BLE_GAP_ROLE_CENTRAL
+#include "ble_types.h"          // BLE_CONN_HANDLE_INVALID, ble_data_t
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Assigns a free link of the given instance to the connection from the
+** event, and opens its channel if central.
+*/
+static void ble_l2cap_ch_on_connect_evt(const ble_gap_evt_t* event,
+                                        ble_l2cap_ch_t* instance);
+
+/* Hands the messages waiting in the sending queue of the given link to
+** the stack, as long as its channel can take them.
+*/
+static void ble_l2cap_ch_link_tx_kick(ble_l2cap_ch_link_t* link);
+
+/* Resets the channel of the given link, and notifies the application if
+** it was open. Messages in flight stay in the sending queue.
+*/
+static void ble_l2cap_ch_close(ble_l2cap_ch_t* instance,
+                               ble_l2cap_ch_link_t* link);
+
+/* Accepts the channel requested by the peer on the expected PSM, if the
+** connection has a link without channel. Refuses it otherwise.
+*/
+static void ble_l2cap_ch_on_setup_request_evt(const ble_l2cap_evt_t* event,
+                                              ble_l2cap_ch_link_t* link);
+
+/* Stores the channel parameters, gives the reception buffers and credits
+** to the stack, notifies the application and starts sending.
+*/
+static void ble_l2cap_ch_on_setup_evt(const ble_l2cap_evt_t* event,
+                                      ble_l2cap_ch_t* instance,
+                                      ble_l2cap_ch_link_t* link);
+
+// Hands the received message to the application, and gives its buffer back.
+static void ble_l2cap_ch_on_rx_evt(const ble_l2cap_evt_t* event,
+                                   ble_l2cap_ch_t* instance,
+                                   ble_l2cap_ch_link_t* link);
+
+// Pops the sent message, notifies the application and sends the next ones.
+static void ble_l2cap_ch_on_tx_evt(ble_l2cap_ch_t* instance,
+                                   ble_l2cap_ch_link_t* link);
+
+/* Calls the event handler of the given instance with the given event type
+** for the given link.
+*/
+static void ble_l2cap_ch_evt_send(ble_l2cap_ch_t* instance,
+                                  const ble_l2cap_ch_link_t* link,
+                                  ble_l2cap_ch_evt_type_t evt_type);
+
+ret_code_t ble_l2cap_ch_cfg_set(uint8_t conn_cfg_tag, uint32_t ram_start)
+{
+    ble_cfg_t cfg;
+    memset(&cfg, 0, sizeof(ble_cfg_t));
+
+    cfg.conn_cfg.conn_cfg_tag                       = conn_cfg_tag;
+    cfg.conn_cfg.params.l2cap_conn_cfg.rx_mps       = BLE_L2CAP_CH_MPS;
+    cfg.conn_cfg.params.l2cap_conn_cfg.tx_mps       = BLE_L2CAP_CH_MPS;
+    cfg.conn_cfg.params.l2cap_conn_cfg.rx_queue_size
+        = BLE_L2CAP_CH_RX_QUEUE_SIZE;
+    cfg.conn_cfg.params.l2cap_conn_cfg.tx_queue_size
+        = BLE_L2CAP_CH_TX_QUEUE_SIZE;
+    cfg.conn_cfg.params.l2cap_conn_cfg.ch_count     = 1;
+
+    return sd_ble_cfg_set(BLE_CONN_CFG_L2CAP, &cfg, ram_start);
+}
+
+void ble_l2cap_ch_init(ble_l2cap_ch_t* instance,
+                       const ble_l2cap_ch_init_t* parameters)
+{
+    memset(instance, 0, sizeof(ble_l2cap_ch_t));
+
+    instance->evt_handler = parameters->evt_handler;
+
+    for (uint8_t link_idx = 0; link_idx < BLE_L2CAP_CH_MAX_LINKS; link_idx++)
+    {
+        ble_l2cap_ch_link_t* link = &(instance->links[link_idx]);
+
+        link->conn_handle   = BLE_CONN_HANDLE_INVALID;
+        link->local_cid     = BLE_L2CAP_CID_INVALID;
+        link->tx_queue      = parameters->tx_queues[link_idx];
+    }
+}
+
+void ble_l2cap_ch_tx_kick(ble_l2cap_ch_t* instance)
+{
+    for (uint8_t link_idx = 0; link_idx < BLE_L2CAP_CH_MAX_LINKS; link_idx++)
+    {
+        ble_l2cap_ch_link_tx_kick(&(instance->links[link_idx]));
+    }
+}
+
+void ble_l2cap_ch_on_ble_evt(ble_evt_t const* event, void* context)
+{
+    ble_l2cap_ch_t* instance = (ble_l2cap_ch_t*)context;
+
+    if (event->header.evt_id == BLE_GAP_EVT_CONNECTED)
+    {
+        ble_l2cap_ch_on_connect_evt(&(event->evt.gap_evt), instance);
+        return;
+    }
+
+    // All connection events start with their connection handle.
+    ble_l2cap_ch_link_t* link = ble_l2cap_ch_link_get(instance,
+        event->evt.gap_evt.conn_handle);
+
+    switch (event->header.evt_id)
+    {
+    case BLE_GAP_EVT_DISCONNECTED:
+        if (link != NULL)
+        {
+            ble_l2cap_ch_close(instance, link);
+            link->conn_handle = BLE_CONN_HANDLE_INVALID;
+        }
+        break;
+    case BLE_L2CAP_EVT_CH_SETUP_REQUEST:
+        // Answered even without link: the request times out otherwise.
+        ble_l2cap_ch_on_setup_request_evt(&(event->evt.l2cap_evt), link);
+        break;
+    case BLE_L2CAP_EVT_CH_SETUP_REFUSED:
+        #ifdef DEBUG
+        NRF_LOG_INFO("L2CAP: Channel refused (status: 0x%04x)!",
+                     event->evt.l2cap_evt.params.ch_setup_refused.status);
+        #endif /* DEBUG */
+        break;
+    case BLE_L2CAP_EVT_CH_SETUP:
+        if (link != NULL)
+        {
+            ble_l2cap_ch_on_setup_evt(&(event->evt.l2cap_evt), instance,
+                                      link);
+        }
+        break;
+    case BLE_L2CAP_EVT_CH_RELEASED:
+        if ((link != NULL)
+            && (event->evt.l2cap_evt.local_cid == link->local_cid))
+        {
+            ble_l2cap_ch_close(instance, link);
+        }
+        break;
+    case BLE_L2CAP_EVT_CH_RX:
+        if (link != NULL)
+        {
+            ble_l2cap_ch_on_rx_evt(&(event->evt.l2cap_evt), instance, link);
+        }
+        break;
+    case BLE_L2CAP_EVT_CH_TX:
+        if (link != NULL)
+        {
+            ble_l2cap_ch_on_tx_evt(instance, link);
+        }
+        break;
+    case BLE_L2CAP_EVT_CH_CREDIT:
+        if (link != NULL)
+        {
+            ble_l2cap_ch_link_tx_kick(link);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+ble_l2cap_ch_link_t* ble_l2cap_ch_link_get(ble_l2cap_ch_t* instance,
+                                           uint16_t conn_handle)
+{
+    if (conn_handle == BLE_CONN_HANDLE_INVALID)
+    {
+        return NULL;
+    }
+
+    for (uint8_t link_idx = 0; link_idx < BLE_L2CAP_CH_MAX_LINKS; link_idx++)
+    {
+        if (instance->links[link_idx].conn_handle == conn_handle)
+        {
+            return &(instance->links[link_idx]);
+        }
+    }
+
+    return NULL;
+}
+
+static void ble_l2cap_ch_on_connect_evt(const ble_gap_evt_t* event,
+                                        ble_l2cap_ch_t* instance)
+{
+    ble_l2cap_ch_link_t* link = NULL;
+    for (uint8_t link_idx = 0; link_idx < BLE_L2CAP_CH_MAX_LINKS; link_idx++)
+    {
+        if (instance->links[link_idx].conn_handle == BLE_CONN_HANDLE_INVALID)
+        {
+            link = &(instance->links[link_idx]);
+            break;
+        }
+    }
+
+    if (link == NULL)
+    {
+        // More connections than links: no channel on this one.
+        return;
+    }
+
+    link->conn_handle = event->conn_handle;
+
+    if (event->params.connected.role != BLE_GAP_ROLE_CENTRAL)
+    {
+        // Wait for the central to open the channel.
+        return;
+    }
+
+    ble_l2cap_ch_setup_params_t params;
+    memset(&params, 0, sizeof(ble_l2cap_ch_setup_params_t));
+
+    params.le_psm               = BLE_L2CAP_CH_PSM;
+    params.rx_params.rx_mtu     = BLE_L2CAP_CH_SDU_SIZE;
+    params.rx_params.rx_mps     = BLE_L2CAP_CH_MPS;
+
+    // Reception buffers are given once the channel is set up.
+    params.rx_params.sdu_buf.p_data = NULL;
+    params.rx_params.sdu_buf.len    = 0;
+
+    uint16_t local_cid = BLE_L2CAP_CID_INVALID;
+
+    ret_code_t err_code = sd_ble_l2cap_ch_setup(link->conn_handle,
+                                                &local_cid, &params);
+    APP_ERROR_CHECK(err_code);
+}
+
+static void ble_l2cap_ch_link_tx_kick(ble_l2cap_ch_link_t* link)
+{
+    if (link->tx_queue == NULL)
+    {
+        return;
+    }
+
+    // Both the application and the BLE events consume the queue.
+    CRITICAL_REGION_ENTER();
+
+    while ((link->local_cid != BLE_L2CAP_CID_INVALID)
+           && (link->nb_in_flight < BLE_L2CAP_CH_TX_QUEUE_SIZE))
+    {
+        // Messages in flight are the oldest ones in the queue.
+        tx_buffer_t views[BLE_L2CAP_CH_TX_QUEUE_SIZE];
+        uint16_t nb_peeked = msg_queue_inst_peek_n(link->tx_queue, views,
+                                                   link->nb_in_flight + 1);
+        if (nb_peeked <= link->nb_in_flight)
+        {
+            // Nothing left to send.
+            break;
+        }
+
+        ble_data_t sdu;
+        sdu.p_data  = views[link->nb_in_flight].buffer;
+        sdu.len     = views[link->nb_in_flight].size;
+
+        ret_code_t err_code = sd_ble_l2cap_ch_tx(link->conn_handle,
+                                                 link->local_cid, &sdu);
+        if (err_code == NRF_ERROR_RESOURCES)
+        {
+            // Stack queue full: try again once a message is sent.
+            link->stats.stall_count++;
+            break;
+        }
+        else if (err_code == NRF_ERROR_INVALID_PARAM)
+        {
+            // Larger than the peer accepts: cannot ever be sent.
+            #ifdef DEBUG
+            NRF_LOG_INFO("L2CAP: Dropping %u-byte message (MTU: %u)!",
+                         sdu.len, link->peer_mtu);
+            #endif /* DEBUG */
+
+            if (link->nb_in_flight == 0)
+            {
+                msg_queue_inst_pop(link->tx_queue);
+                continue;
+            }
+
+            // Drop it once the messages before it are popped.
+            break;
+        }
+        else if (err_code == NRF_ERROR_INVALID_STATE)
+        {
+            // Channel released: the release event resets it.
+            break;
+        }
+
+        APP_ERROR_CHECK(err_code);
+
+        link->nb_in_flight++;
+    }
+
+    CRITICAL_REGION_EXIT();
+}
+
+static void ble_l2cap_ch_close(ble_l2cap_ch_t* instance,
+                               ble_l2cap_ch_link_t* link)
+{
+    if (link->local_cid == BLE_L2CAP_CID_INVALID)
+    {
+        return;
+    }
+
+    link->local_cid     = BLE_L2CAP_CID_INVALID;
+    link->nb_in_flight  = 0;
+
+    ble_l2cap_ch_evt_send(instance, link, BLE_L2CAP_CH_EVT_CLOSED);
+}
+
+static void ble_l2cap_ch_on_setup_request_evt(const ble_l2cap_evt_t* event,
+                                              ble_l2cap_ch_link_t* link)
+{
+    ble_l2cap_ch_setup_params_t params;
+    memset(&params, 0, sizeof(ble_l2cap_ch_setup_params_t));
+
+    params.rx_params.rx_mtu     = BLE_L2CAP_CH_SDU_SIZE;
+    params.rx_params.rx_mps     = BLE_L2CAP_CH_MPS;
+
+    if ((event->params.ch_setup_request.le_psm != BLE_L2CAP_CH_PSM)
+        || (link == NULL)
+        || (link->local_cid != BLE_L2CAP_CID_INVALID))
+    {
+        params.status = BLE_L2CAP_CH_STATUS_CODE_LE_PSM_NOT_SUPPORTED;
+    }
+    else
+    {
+        params.status = BLE_L2CAP_CH_STATUS_CODE_SUCCESS;
+    }
+
+    uint16_t local_cid = event->local_cid;
+
+    ret_code_t err_code = sd_ble_l2cap_ch_setup(event->conn_handle,
+                                                &local_cid, &params);
+    APP_ERROR_CHECK(err_code);
+}
+
+static void ble_l2cap_ch_on_setup_evt(const ble_l2cap_evt_t* event,
+                                      ble_l2cap_ch_t* instance,
+                                      ble_l2cap_ch_link_t* link)
+{
+    link->local_cid     = event->local_cid;
+    link->peer_mtu      = event->params.ch_setup.tx_params.tx_mtu;
+    link->nb_in_flight  = 0;
+
+    for (uint8_t buffer_idx = 0; buffer_idx < BLE_L2CAP_CH_RX_QUEUE_SIZE;
+         buffer_idx++)
+    {
+        ble_data_t sdu_buffer;
+        sdu_buffer.p_data   = link->rx_buffers[buffer_idx];
+        sdu_buffer.len      = BLE_L2CAP_CH_SDU_SIZE;
+
+        ret_code_t err_code = sd_ble_l2cap_ch_rx(link->conn_handle,
+                                                 link->local_cid,
+                                                 &sdu_buffer);
+        APP_ERROR_CHECK(err_code);
+    }
+
+    // The peer may only send a single segment until given credits.
+    ret_code_t err_code = sd_ble_l2cap_ch_flow_control(
+        link->conn_handle, link->local_cid, BLE_L2CAP_CH_RX_CREDITS, NULL);
+    APP_ERROR_CHECK(err_code);
+
+    #ifdef DEBUG
+    NRF_LOG_INFO("L2CAP: Channel open on %u (peer MTU: %u, MPS: %u)!",
+                 link->conn_handle, link->peer_mtu,
+                 event->params.ch_setup.tx_params.tx_mps);
+    #endif /* DEBUG */
+
+    ble_l2cap_ch_evt_send(instance, link, BLE_L2CAP_CH_EVT_OPENED);
+
+    ble_l2cap_ch_link_tx_kick(link);
+}
+
+static void ble_l2cap_ch_on_rx_evt(const ble_l2cap_evt_t* event,
+                                   ble_l2cap_ch_t* instance,
+                                   ble_l2cap_ch_link_t* link)
+{
+    const ble_data_t* sdu_buffer = &(event->params.rx.sdu_buf);
+
+    link->stats.rx_count++;
+
+    if (instance->evt_handler != NULL)
+    {
+        ble_l2cap_ch_evt_t ch_event;
+        memset(&ch_event, 0, sizeof(ble_l2cap_ch_evt_t));
+
+        ch_event.evt_type       = BLE_L2CAP_CH_EVT_RX;
+        ch_event.conn_handle    = link->conn_handle;
+        ch_event.data           = sdu_buffer->p_data;
+        ch_event.size           = event->params.rx.sdu_len;
+
+        instance->evt_handler(&ch_event);
+    }
+
+    // The message is consumed: the buffer can take the next one.
+    ret_code_t err_code = sd_ble_l2cap_ch_rx(event->conn_handle,
+                                             event->local_cid, sdu_buffer);
+    if (err_code != NRF_ERROR_INVALID_STATE)
+    {
+        APP_ERROR_CHECK(err_code);
+    }
+}
+
+static void ble_l2cap_ch_on_tx_evt(ble_l2cap_ch_t* instance,
+                                   ble_l2cap_ch_link_t* link)
+{
+    CRITICAL_REGION_ENTER();
+
+    if (link->nb_in_flight > 0)
+    {
+        msg_queue_inst_pop(link->tx_queue);
+        link->nb_in_flight--;
+    }
+
+    CRITICAL_REGION_EXIT();
+
+    link->stats.tx_count++;
+
+    ble_l2cap_ch_evt_send(instance, link, BLE_L2CAP_CH_EVT_TX);
+
+    ble_l2cap_ch_link_tx_kick(link);
+}
+
+static void ble_l2cap_ch_evt_send(ble_l2cap_ch_t* instance,
+                                  const ble_l2cap_ch_link_t* link,
+                                  ble_l2cap_ch_evt_type_t evt_type)
+{
+    if (instance->evt_handler == NULL)
+    {
+        return;
+    }
+
+    ble_l2cap_ch_evt_t event;
+    memset(&event, 0, sizeof(ble_l2cap_ch_evt_t));
+
+    event.evt_type      = evt_type;
+    event.conn_handle   = link->conn_handle;
+
+    instance->evt_handler(&event);
+}
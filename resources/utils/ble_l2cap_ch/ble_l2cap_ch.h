@@ -0,0 +1,200 @@
+#ifndef BLE_L2CAP_CH_H
+#define BLE_L2CAP_CH_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+
+// NRF
+#include "nrf_sdh_ble.h"    // NRF_SDH_BLE_OBSERVER
+#include "sdk_errors.h"     // ret_code_t
+
+// SOFTDEVICE
+#include "ble.h"            // ble_evt_t
+#include "ble_l2cap.h"      // BLE_L2CAP_*
+
+// CUSTOM
+#include "msg_queue.h"      // msg_queue_t, tx_buffer_t
+
+/*      CONSTANTS                                                   */
+
+/* An LE connection-oriented channel carries whole messages (SDUs) with
+** credit-based flow control, as an alternative to NUS: no ATT overhead
+** per packet and no chunking above the link layer. The central opens
+** the channel once connected, the peripheral accepts it. Each connection
+** gets its own channel.
+**
+** Messages to send are taken from the msg_queue of the channel's link
+** and handed to the stack without copy: they are only popped once sent.
+** Received messages are handed to the event handler, and shall be
+** consumed before it returns.
+**
+** Programs select it with the `COM_BACKEND` CMake variable, which defines
+** `COM_BACKEND_L2CAP` for the HAL to use it instead of NUS.
+*/
+
+// Maximum number of links, each with a channel.
+#define BLE_L2CAP_CH_MAX_LINKS      NRF_SDH_BLE_TOTAL_LINK_COUNT
+
+// L2CAP channel BLE observer priority.
+#define BLE_L2CAP_CH_BLE_OBS_PRIO   2
+
+// Protocol/Service Multiplexer of the channel, in the dynamic range.
+#define BLE_L2CAP_CH_PSM            0x0080
+
+// Maximum size of a message.
+#define BLE_L2CAP_CH_SDU_SIZE       256
+
+// Maximum size of a link layer payload carrying a message segment.
+#define BLE_L2CAP_CH_MPS            (NRF_SDH_BLE_GAP_DATA_LENGTH - 4)
+
+// Number of messages which can be simultaneously sent and received.
+#define BLE_L2CAP_CH_TX_QUEUE_SIZE  2
+#define BLE_L2CAP_CH_RX_QUEUE_SIZE  2
+
+// Number of segments the peer may send before waiting for credits.
+#define BLE_L2CAP_CH_RX_CREDITS     10
+
+/* Defines an L2CAP channel instance and assigns its BLE observer. Its
+** reception buffers are part of the instance.
+*/
+#define BLE_L2CAP_CH_DEF(_instance_name)                \
+    static ble_l2cap_ch_t _instance_name;               \
+    NRF_SDH_BLE_OBSERVER(_instance_name ## _ble_obs,    \
+        BLE_L2CAP_CH_BLE_OBS_PRIO,                      \
+        ble_l2cap_ch_on_ble_evt,                        \
+        &_instance_name                                 \
+    )/*;*/
+
+// L2CAP channel event type.
+typedef enum
+{
+    // Channel opened: messages can be sent.
+    BLE_L2CAP_CH_EVT_OPENED,
+
+    // Channel closed.
+    BLE_L2CAP_CH_EVT_CLOSED,
+
+    // Message received.
+    BLE_L2CAP_CH_EVT_RX,
+
+    // Message sent and popped from the sending queue.
+    BLE_L2CAP_CH_EVT_TX,
+} ble_l2cap_ch_evt_type_t;
+
+// L2CAP channel event.
+typedef struct
+{
+    // Event type.
+    ble_l2cap_ch_evt_type_t evt_type;
+
+    // Connection of the channel.
+    uint16_t                conn_handle;
+
+    // BLE_L2CAP_CH_EVT_RX: Received message, valid during the event.
+    const uint8_t*          data;
+    uint16_t                size;
+} ble_l2cap_ch_evt_t;
+
+// L2CAP channel event handler.
+typedef void(*ble_l2cap_ch_evt_handler_t)(const ble_l2cap_ch_evt_t* event);
+
+// Parameters needed to initialize an L2CAP channel instance.
+typedef struct
+{
+    // L2CAP channel event handler.
+    ble_l2cap_ch_evt_handler_t  evt_handler;
+
+    /* Queues of the messages to send, one per link. A connection takes
+    ** the first free link.
+    */
+    msg_queue_t*                tx_queues[BLE_L2CAP_CH_MAX_LINKS];
+} ble_l2cap_ch_init_t;
+
+// Statistics of an L2CAP channel.
+typedef struct
+{
+    // Number of sent and received messages.
+    uint32_t    tx_count;
+    uint32_t    rx_count;
+
+    // Number of times sending stopped for lack of credits or buffers.
+    uint32_t    stall_count;
+} ble_l2cap_ch_stats_t;
+
+// Link of an L2CAP channel instance, with its channel.
+typedef struct
+{
+    // Connection handle, or BLE_CONN_HANDLE_INVALID if unused.
+    uint16_t                    conn_handle;
+
+    // Local channel identifier, or BLE_L2CAP_CID_INVALID if closed.
+    uint16_t                    local_cid;
+
+    // Size of the largest message the peer accepts.
+    uint16_t                    peer_mtu;
+
+    // Number of messages handed to the stack and not sent yet.
+    uint8_t                     nb_in_flight;
+
+    // Queue of the messages to send.
+    msg_queue_t*                tx_queue;
+
+    // Reception buffers.
+    uint8_t                     rx_buffers[BLE_L2CAP_CH_RX_QUEUE_SIZE]
+                                          [BLE_L2CAP_CH_SDU_SIZE];
+
+    // Statistics.
+    ble_l2cap_ch_stats_t        stats;
+} ble_l2cap_ch_link_t;
+
+// L2CAP channel instance.
+typedef struct
+{
+    // Event handler for this instance.
+    ble_l2cap_ch_evt_handler_t  evt_handler;
+
+    // Links.
+    ble_l2cap_ch_link_t         links[BLE_L2CAP_CH_MAX_LINKS];
+} ble_l2cap_ch_t;
+
+/* Adds the L2CAP channel configuration to the SoftDevice configuration
+** of the given connection tag. Shall be called between
+** `nrf_sdh_ble_default_cfg_set` and `nrf_sdh_ble_enable`.
+*/
+ret_code_t ble_l2cap_ch_cfg_set(uint8_t conn_cfg_tag, uint32_t ram_start);
+
+// Initializes the given L2CAP channel instance with the given parameters.
+void ble_l2cap_ch_init(ble_l2cap_ch_t* instance,
+                       const ble_l2cap_ch_init_t* parameters);
+
+/* Hands the messages waiting in the sending queues to the stack, as long
+** as the channels can take them. Shall be called after enqueuing. Can be
+** called from any context.
+*/
+void ble_l2cap_ch_tx_kick(ble_l2cap_ch_t* instance);
+
+/* Connection:          Assigns a free link, and opens its channel if
+**                      central.
+** Disconnection:       Resets the channel, and frees the link.
+** Setup request:       Accepts the channel.
+** Setup:               Gives the reception buffers and credits, and
+**                      starts sending.
+** Released:            Resets the channel.
+** RX:                  Hands the message to the application, and gives
+**                      its buffer back.
+** TX:                  Pops the sent message, notifies the application
+**                      and sends the next ones.
+** Credits:             Sends the next messages.
+*/
+void ble_l2cap_ch_on_ble_evt(ble_evt_t const* event, void* context);
+
+/* Returns the link of the given instance for the given connection, or
+** NULL if the connection has none.
+*/
+ble_l2cap_ch_link_t* ble_l2cap_ch_link_get(ble_l2cap_ch_t* instance,
+                                           uint16_t conn_handle);
+
+#endif /* ! BLE_L2CAP_CH_H */
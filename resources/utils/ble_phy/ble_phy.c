@@ -0,0 +1,289 @@
+#include "ble_phy.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stddef.h>         // NULL
+#include <string.h>         // memset
+
+// NRF
+#include "nrf_log.h"        // NRF_LOG_INFO
+#include "sdk_errors.h"     // ret_code_t, NRF_ERROR_*
+
+// NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+
+// SOFTDEVICE
+#include "ble_gap.h"        /* ble_gap_*, sd_ble_gap_phy_update,
+                            ** sd_ble_gap_rssi_start, BLE_GAP_EVT_*,
+                            ** BLE_GAP_PHY_*
+                            */
+#include "ble_hci.h"        // BLE_HCI_STATUS_CODE_SUCCESS
+#include "ble_types.h"      // BLE_CONN_HANDLE_INVALID
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Assigns a free link of the given instance to the connection, requests
+** the preferred PHY and starts RSSI reporting if there is a policy.
+*/
+static void ble_phy_on_connect_evt(const ble_gap_evt_t* event,
+                                   ble_phy_t* instance);
+
+/* Stores the PHY from the given event in the statistics of the given
+** link, and sends the request which could not be sent while the update
+** was ongoing.
+*/
+static void ble_phy_on_update_evt(const ble_gap_evt_phy_update_t* event,
+                                  ble_phy_link_t* link);
+
+/* Stores the RSSI from the given event, and requests the PHY given by
+** the policy of the given instance if it changed.
+*/
+static void ble_phy_on_rssi_evt(const ble_gap_evt_rssi_changed_t* event,
+                                ble_phy_t* instance, ble_phy_link_t* link);
+
+/* Requests the PHY the given link shall use. If the chip does not
+** support it, falls back to 1M PHY.
+*/
+static void ble_phy_request(ble_phy_link_t* link);
+
+/* Answers a PHY update request on a connection which is not managed, as
+** all links are in use.
+*/
+static void ble_phy_on_other_update_request_evt(const ble_gap_evt_t* event);
+
+void ble_phy_init(ble_phy_t* instance, const ble_phy_init_t* parameters)
+{
+    memset(instance, 0, sizeof(ble_phy_t));
+
+    instance->preferred_phy = parameters->preferred_phy;
+    instance->policy        = parameters->policy;
+
+    for (uint8_t link_idx = 0; link_idx < BLE_PHY_MAX_LINKS; link_idx++)
+    {
+        instance->links[link_idx].conn_handle = BLE_CONN_HANDLE_INVALID;
+    }
+}
+
+void ble_phy_on_ble_evt(ble_evt_t const* event, void* context)
+{
+    ble_phy_t* instance = (ble_phy_t*)context;
+
+    if (event->header.evt_id == BLE_GAP_EVT_CONNECTED)
+    {
+        ble_phy_on_connect_evt(&(event->evt.gap_evt), instance);
+        return;
+    }
+
+    // All connection events start with their connection handle.
+    ble_phy_link_t* link = ble_phy_link_get(instance,
+                                            event->evt.gap_evt.conn_handle);
+    if (link == NULL)
+    {
+        if (event->header.evt_id == BLE_GAP_EVT_PHY_UPDATE_REQUEST)
+        {
+            ble_phy_on_other_update_request_evt(&(event->evt.gap_evt));
+        }
+
+        return;
+    }
+
+    switch (event->header.evt_id)
+    {
+    case BLE_GAP_EVT_DISCONNECTED:
+        link->conn_handle       = BLE_CONN_HANDLE_INVALID;
+        link->request_pending   = false;
+        break;
+    case BLE_GAP_EVT_PHY_UPDATE_REQUEST:
+        // The peer initiated the procedure: answer with our own choice.
+        ble_phy_request(link);
+        break;
+    case BLE_GAP_EVT_PHY_UPDATE:
+        ble_phy_on_update_evt(&(event->evt.gap_evt.params.phy_update),
+                              link);
+        break;
+    case BLE_GAP_EVT_RSSI_CHANGED:
+        ble_phy_on_rssi_evt(&(event->evt.gap_evt.params.rssi_changed),
+                            instance, link);
+        break;
+    default:
+        break;
+    }
+}
+
+ble_phy_link_t* ble_phy_link_get(ble_phy_t* instance, uint16_t conn_handle)
+{
+    if (conn_handle == BLE_CONN_HANDLE_INVALID)
+    {
+        return NULL;
+    }
+
+    for (uint8_t link_idx = 0; link_idx < BLE_PHY_MAX_LINKS; link_idx++)
+    {
+        if (instance->links[link_idx].conn_handle == conn_handle)
+        {
+            return &(instance->links[link_idx]);
+        }
+    }
+
+    return NULL;
+}
+
+uint8_t ble_phy_rssi_policy(int8_t rssi, uint8_t current_phy)
+{
+    if (rssi < BLE_PHY_RSSI_LOW)
+    {
+        return BLE_GAP_PHY_1MBPS;
+    }
+
+    if (rssi > BLE_PHY_RSSI_HIGH)
+    {
+        return BLE_GAP_PHY_2MBPS;
+    }
+
+    // Hysteresis: keep the current PHY between the thresholds.
+    return current_phy;
+}
+
+static void ble_phy_on_connect_evt(const ble_gap_evt_t* event,
+                                   ble_phy_t* instance)
+{
+    ble_phy_link_t* link = NULL;
+    for (uint8_t link_idx = 0; link_idx < BLE_PHY_MAX_LINKS; link_idx++)
+    {
+        if (instance->links[link_idx].conn_handle == BLE_CONN_HANDLE_INVALID)
+        {
+            link = &(instance->links[link_idx]);
+            break;
+        }
+    }
+
+    if (link == NULL)
+    {
+        // More connections than links: this one keeps the stack's PHY.
+        return;
+    }
+
+    link->conn_handle       = event->conn_handle;
+    link->requested_phy     = instance->preferred_phy;
+    link->request_pending   = false;
+
+    link->stats.tx_phy      = BLE_GAP_PHY_1MBPS;
+    link->stats.rx_phy      = BLE_GAP_PHY_1MBPS;
+    link->stats.rssi        = 0;
+
+    if (link->requested_phy != BLE_GAP_PHY_1MBPS)
+    {
+        ble_phy_request(link);
+    }
+
+    if (instance->policy == NULL)
+    {
+        // RSSI is only needed by the policy.
+        return;
+    }
+
+    ret_code_t err_code = sd_ble_gap_rssi_start(link->conn_handle,
+                                                BLE_PHY_RSSI_THRESHOLD,
+                                                BLE_PHY_RSSI_SKIP_COUNT);
+    APP_ERROR_CHECK(err_code);
+}
+
+static void ble_phy_on_update_evt(const ble_gap_evt_phy_update_t* event,
+                                  ble_phy_link_t* link)
+{
+    if (event->status == BLE_HCI_STATUS_CODE_SUCCESS)
+    {
+        link->stats.tx_phy = event->tx_phy;
+        link->stats.rx_phy = event->rx_phy;
+        link->stats.update_count++;
+
+        #ifdef DEBUG
+        NRF_LOG_INFO("PHY updated on %u: TX %u, RX %u!", link->conn_handle,
+                     event->tx_phy, event->rx_phy);
+        #endif /* DEBUG */
+    }
+
+    if (link->request_pending)
+    {
+        ble_phy_request(link);
+    }
+}
+
+static void ble_phy_on_rssi_evt(const ble_gap_evt_rssi_changed_t* event,
+                                ble_phy_t* instance, ble_phy_link_t* link)
+{
+    link->stats.rssi = event->rssi;
+
+    if (instance->policy == NULL)
+    {
+        return;
+    }
+
+    uint8_t phy = instance->policy(event->rssi, link->stats.tx_phy);
+    if (phy == link->requested_phy)
+    {
+        // Already requested.
+        return;
+    }
+
+    link->requested_phy = phy;
+    ble_phy_request(link);
+}
+
+static void ble_phy_request(ble_phy_link_t* link)
+{
+    ble_gap_phys_t phys =
+    {
+        .tx_phys = link->requested_phy,
+        .rx_phys = link->requested_phy,
+    };
+
+    link->request_pending = false;
+
+    ret_code_t err_code = sd_ble_gap_phy_update(link->conn_handle, &phys);
+    switch (err_code)
+    {
+    case NRF_ERROR_BUSY:
+        // A procedure is ongoing: request again once it is complete.
+        link->request_pending = true;
+        break;
+    case NRF_ERROR_NOT_SUPPORTED:
+        if (link->requested_phy == BLE_GAP_PHY_1MBPS)
+        {
+            APP_ERROR_CHECK(err_code);
+            break;
+        }
+
+        #ifdef DEBUG
+        NRF_LOG_INFO("PHY %u not supported: falling back to 1M!",
+                     link->requested_phy);
+        #endif /* DEBUG */
+
+        link->requested_phy = BLE_GAP_PHY_1MBPS;
+        ble_phy_request(link);
+        break;
+    case NRF_ERROR_INVALID_STATE:
+        // Disconnected, or request already answered by another module.
+        break;
+    default:
+        APP_ERROR_CHECK(err_code);
+        break;
+    }
+}
+
+static void ble_phy_on_other_update_request_evt(const ble_gap_evt_t* event)
+{
+    // The procedure times out if unanswered: let the stack pick the PHY.
+    ble_gap_phys_t phys =
+    {
+        .tx_phys = BLE_GAP_PHY_AUTO,
+        .rx_phys = BLE_GAP_PHY_AUTO,
+    };
+
+    ret_code_t err_code = sd_ble_gap_phy_update(event->conn_handle, &phys);
+    if (err_code != NRF_ERROR_INVALID_STATE)
+    {
+        APP_ERROR_CHECK(err_code);
+    }
+}
@@ -0,0 +1,131 @@
+#ifndef BLE_PHY_H
+#define BLE_PHY_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t, int8_t
+
+// NRF
+#include "nrf_sdh_ble.h"    // NRF_SDH_BLE_OBSERVER
+
+// SOFTDEVICE
+#include "ble.h"            // ble_evt_t
+
+/*      CONSTANTS                                                   */
+
+// PHY manager BLE observer priority.
+#define BLE_PHY_BLE_OBS_PRIO        2
+
+/* RSSI thresholds of the default policy, in dBm: below the low one, the
+** link falls back to 1M PHY; above the high one, it goes back to 2M PHY.
+*/
+#define BLE_PHY_RSSI_LOW            (-80)
+#define BLE_PHY_RSSI_HIGH           (-70)
+
+// Minimum RSSI change, in dBm, reported to the policy.
+#define BLE_PHY_RSSI_THRESHOLD      5
+
+// Number of RSSI samples which must differ before a change is reported.
+#define BLE_PHY_RSSI_SKIP_COUNT     10
+
+// Maximum number of links managed at once.
+#define BLE_PHY_MAX_LINKS           NRF_SDH_BLE_TOTAL_LINK_COUNT
+
+// Defines a PHY manager instance and assigns its BLE observer.
+#define BLE_PHY_DEF(_instance_name)                     \
+    static ble_phy_t _instance_name;                    \
+    NRF_SDH_BLE_OBSERVER(_instance_name ## _ble_obs,    \
+        BLE_PHY_BLE_OBS_PRIO,                           \
+        ble_phy_on_ble_evt,                             \
+        &_instance_name                                 \
+    )/*;*/
+
+/* Returns the PHY (one of BLE_GAP_PHY_1MBPS, BLE_GAP_PHY_2MBPS or
+** BLE_GAP_PHY_CODED) the link shall use given its last RSSI and its
+** current PHY.
+*/
+typedef uint8_t(*ble_phy_policy_t)(int8_t rssi, uint8_t current_phy);
+
+// Parameters needed to initialize a PHY manager instance.
+typedef struct
+{
+    // PHY requested on connection.
+    uint8_t             preferred_phy;
+
+    // Policy applied on RSSI changes, or NULL to keep the preferred PHY.
+    ble_phy_policy_t    policy;
+} ble_phy_init_t;
+
+// Link statistics of a PHY manager instance.
+typedef struct
+{
+    // Current transmission PHY.
+    uint8_t     tx_phy;
+
+    // Current reception PHY.
+    uint8_t     rx_phy;
+
+    // Last reported RSSI in dBm, or 0 if none was reported.
+    int8_t      rssi;
+
+    // Number of completed PHY updates.
+    uint32_t    update_count;
+} ble_phy_stats_t;
+
+// Link managed by a PHY manager.
+typedef struct
+{
+    // Connection handle, or BLE_CONN_HANDLE_INVALID if unused.
+    uint16_t            conn_handle;
+
+    // PHY the link shall currently use.
+    uint8_t             requested_phy;
+
+    // True if a request could not be sent while a procedure was ongoing.
+    bool                request_pending;
+
+    // Link statistics.
+    ble_phy_stats_t     stats;
+} ble_phy_link_t;
+
+// PHY manager instance.
+typedef struct
+{
+    // PHY requested on connection.
+    uint8_t             preferred_phy;
+
+    // Policy applied on RSSI changes.
+    ble_phy_policy_t    policy;
+
+    // Managed links.
+    ble_phy_link_t      links[BLE_PHY_MAX_LINKS];
+} ble_phy_t;
+
+/* Initializes the given PHY manager instance with the given parameters.
+** The preferred PHY is requested on every connection.
+*/
+void ble_phy_init(ble_phy_t* instance, const ble_phy_init_t* parameters);
+
+/* Connection:          Assigns a free link, requests the preferred PHY
+**                      and starts RSSI reporting.
+** Disconnection:       Frees the link.
+** PHY update request:  Answers with the requested PHY.
+** PHY update:          Stores the new PHY, and sends the pending request.
+** RSSI changed:        Applies the policy.
+** Each connection is managed on its own link.
+*/
+void ble_phy_on_ble_evt(ble_evt_t const* event, void* context);
+
+/* Returns the link of the given instance for the given connection, or
+** NULL if the connection is not managed.
+*/
+ble_phy_link_t* ble_phy_link_get(ble_phy_t* instance, uint16_t conn_handle);
+
+/* Default policy: 1M PHY below BLE_PHY_RSSI_LOW, 2M PHY above
+** BLE_PHY_RSSI_HIGH, current PHY in between.
+*/
+uint8_t ble_phy_rssi_policy(int8_t rssi, uint8_t current_phy);
+
+#endif /* ! BLE_PHY_H */
@@ -0,0 +1,127 @@
+#include "frag.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>    // bool
+#include <stddef.h>     // NULL
+#include <stdint.h>     // uint*_t
+#include <string.h>     // memcpy
+
+#ifdef DEBUG
+#include "nrf_log.h"    // NRF_LOG_INFO
+#endif /* DEBUG */
+
+bool frag_send(frag_tx_t* tx, msg_queue_t* queue, const uint8_t* data,
+               uint16_t size, uint16_t max_fragment_size)
+{
+    if (max_fragment_size <= FRAG_HEADER_SIZE)
+    {
+        #ifdef DEBUG
+        NRF_LOG_INFO("Fragments too small to carry data!");
+        #endif /* DEBUG */
+
+        return false;
+    }
+
+    uint16_t max_chunk_size = max_fragment_size - FRAG_HEADER_SIZE;
+    uint16_t offset         = 0;
+    uint8_t  flags          = FRAG_FIRST;
+
+    do
+    {
+        uint16_t chunk_size = size - offset;
+        if (chunk_size > max_chunk_size)
+        {
+            chunk_size = max_chunk_size;
+        }
+        else
+        {
+            flags |= FRAG_LAST;
+        }
+
+        uint8_t* fragment = msg_queue_inst_reserve(queue, FRAG_HEADER_SIZE
+                                                          + chunk_size);
+        if (fragment == NULL)
+        {
+            // Queue is full: the receiver will miss the last fragment.
+            return false;
+        }
+
+        fragment[0] = flags | (tx->next_seq & FRAG_SEQ_MASK);
+        memcpy(fragment + FRAG_HEADER_SIZE, data + offset, chunk_size);
+        msg_queue_inst_commit(queue, FRAG_HEADER_SIZE + chunk_size);
+
+        tx->next_seq++;
+        offset  += chunk_size;
+        flags   = 0;
+    } while (offset < size);
+
+    return true;
+}
+
+uint16_t frag_receive(frag_rx_t* rx, const uint8_t* fragment,
+                      uint16_t size)
+{
+    if (size < FRAG_HEADER_SIZE)
+    {
+        // Not a fragment.
+        return 0;
+    }
+
+    uint8_t header  = fragment[0];
+    uint8_t seq     = header & FRAG_SEQ_MASK;
+
+    if (rx->synced && (seq == rx->last_seq))
+    {
+        // Same fragment received twice.
+        rx->stats.duplicate_count++;
+        return 0;
+    }
+
+    bool in_sequence = rx->synced
+                       && (seq == ((rx->last_seq + 1) & FRAG_SEQ_MASK));
+
+    rx->synced      = true;
+    rx->last_seq    = seq;
+
+    if (rx->in_frame && (!in_sequence || (header & FRAG_FIRST)))
+    {
+        // A fragment of the current frame is missing.
+        rx->stats.lost_count++;
+        rx->in_frame = false;
+    }
+
+    if (header & FRAG_FIRST)
+    {
+        rx->in_frame    = true;
+        rx->size        = 0;
+    }
+    else if (!rx->in_frame)
+    {
+        // Rest of a dropped frame: wait for the next first fragment.
+        return 0;
+    }
+
+    uint16_t chunk_size = size - FRAG_HEADER_SIZE;
+    if (rx->size + chunk_size > rx->buffer_size)
+    {
+        rx->stats.overflow_count++;
+        rx->in_frame = false;
+        return 0;
+    }
+
+    memcpy(rx->buffer + rx->size, fragment + FRAG_HEADER_SIZE, chunk_size);
+    rx->size += chunk_size;
+
+    if (!(header & FRAG_LAST))
+    {
+        // More fragments to come.
+        return 0;
+    }
+
+    rx->in_frame = false;
+    rx->stats.frame_count++;
+
+    return rx->size;
+}
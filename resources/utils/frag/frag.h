@@ -0,0 +1,111 @@
+#ifndef FRAG_H
+#define FRAG_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>    // bool
+#include <stdint.h>     // uint*_t
+
+// CUSTOM
+#include "msg_queue.h"  // msg_queue_t
+
+/*      DEFINES                                                     */
+
+/* Frames larger than a packet are split in fragments, each starting
+** with a one-byte header:
+** -    bit 7:      first fragment of a frame,
+** -    bit 6:      last fragment of a frame,
+** -    bits 0-5:   sequence number, incremented for every fragment sent.
+** The receiver drops a frame as soon as a fragment is missing, ignores
+** duplicated fragments, and resynchronizes on the next first fragment.
+*/
+
+// Size of the fragment header.
+#define FRAG_HEADER_SIZE    1
+
+// Fragment header flags.
+#define FRAG_FIRST          0x80
+#define FRAG_LAST           0x40
+
+// Mask of the sequence number in the fragment header.
+#define FRAG_SEQ_MASK       0x3F
+
+/* Defines a reassembly instance able to receive frames of at most
+** `_max_size` bytes, and its storage.
+*/
+#define FRAG_RX_DEF(_name, _max_size)                                   \
+    static uint8_t _name ## _buffer[_max_size];                         \
+    static frag_rx_t _name =                                            \
+    {                                                                   \
+        .buffer         = _name ## _buffer,                             \
+        .buffer_size    = (_max_size),                                  \
+    }/*;*/
+
+// Fragmentation instance.
+typedef struct
+{
+    // Sequence number of the next fragment.
+    uint8_t     next_seq;
+
+} frag_tx_t;
+
+// Reception statistics of a reassembly instance.
+typedef struct
+{
+    // Number of reassembled frames.
+    uint32_t    frame_count;
+
+    // Number of frames dropped because a fragment was missing.
+    uint32_t    lost_count;
+
+    // Number of ignored duplicated fragments.
+    uint32_t    duplicate_count;
+
+    // Number of frames dropped because they did not fit in the buffer.
+    uint32_t    overflow_count;
+
+} frag_stats_t;
+
+// Reassembly instance.
+typedef struct
+{
+    // Reassembled bytes of the current frame.
+    uint8_t*        buffer;
+
+    // Size of the buffer in bytes.
+    uint16_t        buffer_size;
+
+    // Number of reassembled bytes of the current frame.
+    uint16_t        size;
+
+    // True while a frame is being reassembled.
+    bool            in_frame;
+
+    // True once a fragment was received.
+    bool            synced;
+
+    // Sequence number of the last received fragment.
+    uint8_t         last_seq;
+
+    // Reception statistics.
+    frag_stats_t    stats;
+
+} frag_rx_t;
+
+/* Splits the given frame in fragments of at most `max_fragment_size`
+** bytes, header included, and enqueues them in the given queue. Returns
+** false if the queue got full: the fragments already enqueued are then
+** dropped by the receiver.
+*/
+bool frag_send(frag_tx_t* tx, msg_queue_t* queue, const uint8_t* data,
+               uint16_t size, uint16_t max_fragment_size);
+
+/* Handles the given received fragment. Returns the size of the frame it
+** completes, located at the beginning of the reassembly buffer and valid
+** until the next call, or 0 if no frame was completed.
+*/
+uint16_t frag_receive(frag_rx_t* rx, const uint8_t* fragment,
+                      uint16_t size);
+
+#endif /* ! FRAG_H */
@@ -0,0 +1,208 @@
+#include "frame.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>    // bool
+#include <stdint.h>     // uint*_t
+
+// NRF APPS
+#include "crc16.h"      // crc16_compute
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// COBS code of a full block, which is not followed by a null byte.
+#define COBS_CODE_FULL  UINT8_MAX
+
+// COBS encoding state.
+typedef struct
+{
+    // Frame being written.
+    uint8_t*    frame;
+
+    // Offset of the code of the current block.
+    uint16_t    code_offset;
+
+    // Offset of the next byte to write.
+    uint16_t    write_offset;
+
+    // Code of the current block: one more than its number of bytes.
+    uint8_t     code;
+
+} cobs_encoder_t;
+
+/*      STATIC FUNCTIONS                                            */
+
+// Encodes the given byte, starting a new block when needed.
+static void cobs_byte_encode(cobs_encoder_t* encoder, uint8_t byte);
+
+// Writes the code of the current block, and starts a new one.
+static void cobs_block_close(cobs_encoder_t* encoder);
+
+/* Checks the CRC of the frame received by the given decoder, updates its
+** statistics and resets it. Returns the size of the message, or 0 if the
+** frame is invalid.
+*/
+static uint16_t frame_end(frame_decoder_t* decoder);
+
+uint16_t frame_encode(const uint8_t* data, uint16_t size, uint8_t* frame,
+                      uint16_t frame_size)
+{
+    if (frame_size < FRAME_ENCODED_SIZE_MAX(size))
+    {
+        // Frame may not fit.
+        return 0;
+    }
+
+    uint16_t crc = crc16_compute(data, size, NULL);
+
+    cobs_encoder_t encoder =
+    {
+        .frame          = frame,
+        .code_offset    = 0,
+        .write_offset   = 1,
+        .code           = 1,
+    };
+
+    for (uint16_t byte_idx = 0; byte_idx < size; byte_idx++)
+    {
+        cobs_byte_encode(&encoder, data[byte_idx]);
+    }
+
+    cobs_byte_encode(&encoder, crc & UINT8_MAX);
+    cobs_byte_encode(&encoder, crc >> 8);
+
+    frame[encoder.code_offset]      = encoder.code;
+    frame[encoder.write_offset++]   = FRAME_DELIMITER;
+
+    return encoder.write_offset;
+}
+
+uint16_t frame_decode(frame_decoder_t* decoder, const uint8_t* data,
+                      uint16_t size, uint16_t* msg_size)
+{
+    *msg_size = 0;
+
+    for (uint16_t byte_idx = 0; byte_idx < size; byte_idx++)
+    {
+        uint8_t byte = data[byte_idx];
+
+        if (byte == FRAME_DELIMITER)
+        {
+            *msg_size = frame_end(decoder);
+            if (*msg_size > 0)
+            {
+                return byte_idx + 1;
+            }
+
+            continue;
+        }
+
+        if (decoder->dropping)
+        {
+            // Waiting for the next delimiter.
+            continue;
+        }
+
+        if (decoder->remaining == 0)
+        {
+            // New block: the previous one stood for a null byte.
+            bool null_byte = (decoder->code != COBS_CODE_FULL);
+
+            decoder->code       = byte;
+            decoder->remaining  = byte - 1;
+
+            if (!null_byte)
+            {
+                continue;
+            }
+
+            byte = 0;
+        }
+        else
+        {
+            decoder->remaining--;
+        }
+
+        if (decoder->size == decoder->buffer_size)
+        {
+            // Message too big: drop the whole frame.
+            decoder->stats.overflow_count++;
+            decoder->dropping = true;
+            continue;
+        }
+
+        decoder->buffer[decoder->size++] = byte;
+    }
+
+    return size;
+}
+
+static void cobs_byte_encode(cobs_encoder_t* encoder, uint8_t byte)
+{
+    if (byte == 0)
+    {
+        // Null bytes end the current block.
+        cobs_block_close(encoder);
+        return;
+    }
+
+    encoder->frame[encoder->write_offset++] = byte;
+    encoder->code++;
+
+    if (encoder->code == COBS_CODE_FULL)
+    {
+        cobs_block_close(encoder);
+    }
+}
+
+static void cobs_block_close(cobs_encoder_t* encoder)
+{
+    encoder->frame[encoder->code_offset]    = encoder->code;
+    encoder->code_offset                    = encoder->write_offset++;
+    encoder->code                           = 1;
+}
+
+static uint16_t frame_end(frame_decoder_t* decoder)
+{
+    uint16_t size       = decoder->size;
+    bool     dropping   = decoder->dropping;
+    bool     truncated  = (decoder->remaining != 0);
+
+    decoder->size       = 0;
+    decoder->code       = COBS_CODE_FULL;
+    decoder->remaining  = 0;
+    decoder->dropping   = false;
+
+    if (dropping)
+    {
+        // Already counted as an overflow.
+        return 0;
+    }
+
+    if (size == 0)
+    {
+        // Consecutive delimiters: nothing was received.
+        return 0;
+    }
+
+    if (truncated || (size <= FRAME_CRC_SIZE))
+    {
+        decoder->stats.error_count++;
+        return 0;
+    }
+
+    uint16_t msg_size = size - FRAME_CRC_SIZE;
+    uint16_t crc = decoder->buffer[msg_size]
+                   | (decoder->buffer[msg_size + 1] << 8);
+
+    if (crc16_compute(decoder->buffer, msg_size, NULL) != crc)
+    {
+        decoder->stats.error_count++;
+        return 0;
+    }
+
+    decoder->stats.frame_count++;
+
+    return msg_size;
+}
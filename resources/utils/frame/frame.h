@@ -0,0 +1,98 @@
+#ifndef FRAME_H
+#define FRAME_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>    // bool
+#include <stdint.h>     // uint*_t
+
+/*      DEFINES                                                     */
+
+/* Frames carry binary messages on a byte stream: each message is
+** followed by its CRC-16/CCITT (little endian), the whole is COBS
+** encoded so that it contains no null byte, and a null byte delimits
+** the frame. A receiver can thus resynchronize on any delimiter.
+*/
+
+// Frame delimiter.
+#define FRAME_DELIMITER         0x00
+
+// Size of the CRC appended to each message.
+#define FRAME_CRC_SIZE          sizeof(uint16_t)
+
+/* Maximum size of the frame carrying a message of the given size: one
+** COBS code every 254 bytes, plus the first one and the delimiter.
+*/
+#define FRAME_ENCODED_SIZE_MAX(_size)                                   \
+    ((_size) + FRAME_CRC_SIZE + ((_size) + FRAME_CRC_SIZE) / 254 + 2)
+
+/* Defines a frame decoder instance able to receive messages of at most
+** `_max_size` bytes, and its storage.
+*/
+#define FRAME_DECODER_DEF(_name, _max_size)                             \
+    static uint8_t _name ## _buffer[(_max_size) + FRAME_CRC_SIZE];      \
+    static frame_decoder_t _name =                                      \
+    {                                                                   \
+        .buffer         = _name ## _buffer,                             \
+        .buffer_size    = (_max_size) + FRAME_CRC_SIZE,                 \
+        .code           = UINT8_MAX,                                    \
+    }/*;*/
+
+// Reception statistics of a decoder.
+typedef struct
+{
+    // Number of correctly received messages.
+    uint32_t    frame_count;
+
+    // Number of frames dropped because of a wrong CRC or encoding.
+    uint32_t    error_count;
+
+    // Number of frames dropped because they did not fit in the buffer.
+    uint32_t    overflow_count;
+
+} frame_stats_t;
+
+// Frame decoder instance.
+typedef struct
+{
+    // Decoded bytes of the current frame, CRC included.
+    uint8_t*        buffer;
+
+    // Size of the buffer in bytes.
+    uint16_t        buffer_size;
+
+    // Number of decoded bytes of the current frame.
+    uint16_t        size;
+
+    // COBS code of the current block.
+    uint8_t         code;
+
+    // Number of bytes left in the current block.
+    uint8_t         remaining;
+
+    // True if the current frame is being dropped.
+    bool            dropping;
+
+    // Reception statistics.
+    frame_stats_t   stats;
+
+} frame_decoder_t;
+
+/* Encodes the given message in the given frame buffer. Returns the size
+** of the frame, delimiter included, or 0 if the buffer is smaller than
+** FRAME_ENCODED_SIZE_MAX(size).
+*/
+uint16_t frame_encode(const uint8_t* data, uint16_t size, uint8_t* frame,
+                      uint16_t frame_size);
+
+/* Decodes the given received bytes with the given decoder, until the end
+** of a valid frame or of the bytes. Returns the number of consumed bytes,
+** and sets `msg_size` to the size of the received message, or to 0 if no
+** message was completed. The message is located at the beginning of the
+** decoder buffer, and is valid until the next call.
+*/
+uint16_t frame_decode(frame_decoder_t* decoder, const uint8_t* data,
+                      uint16_t size, uint16_t* msg_size);
+
+#endif /* ! FRAME_H */
@@ -0,0 +1,371 @@
+#include "gatt_cache.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stddef.h>             // NULL
+#include <string.h>             // memcmp, memcpy, memset
+
+// NRF
+#include "nrf_fstorage.h"       // NRF_FSTORAGE_DEF, nrf_fstorage_*
+#include "nrf_fstorage_sd.h"    // nrf_fstorage_sd
+#include "nrf_log.h"            // NRF_LOG_INFO
+#include "sdk_errors.h"         // ret_code_t, NRF_SUCCESS
+
+// NRF APPS
+#include "app_error.h"          // APP_ERROR_CHECK
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Tag of the written records: "GCR1".
+#define GATT_CACHE_RECORD_TAG   0x31524347
+
+// Number of records the cache page can hold.
+#define GATT_CACHE_NB_RECORDS   \
+    (GATT_CACHE_PAGE_SIZE / sizeof(gatt_cache_entry_t))
+
+// Index returned when no entry matches.
+#define GATT_CACHE_INVALID_IDX  UINT8_MAX
+
+// FNV-1a prime, used by the layout hash.
+#define GATT_CACHE_HASH_PRIME   0x01000193
+
+/* Cache entries. An unused entry keeps the key it last had, so that it
+** can be written as a removal record. The entries are the sources of the
+** flash writes, which complete within a few milliseconds: well before a
+** new connection can modify them again.
+*/
+static gatt_cache_entry_t   s_entries[GATT_CACHE_MAX_ENTRIES];
+
+// Index of the next free record of the cache page.
+static uint16_t             s_next_record   = 0;
+
+// Entry replaced next when the cache is full.
+static uint8_t              s_next_victim   = 0;
+
+// Statistics.
+static gatt_cache_stats_t   s_stats;
+
+// Set once the cache is initialized.
+static bool                 s_initialized   = false;
+
+/*      STATIC FUNCTIONS                                            */
+
+// Loads the entries from the records of the cache page.
+static void gatt_cache_load(void);
+
+// Sets the key of the given entry from the given peer and layout.
+static void gatt_cache_key_set(gatt_cache_entry_t* entry,
+                               const ble_gap_addr_t* addr,
+                               uint32_t db_hash);
+
+/* Returns the index of the used entry having the key of the given entry,
+** or GATT_CACHE_INVALID_IDX if there is none.
+*/
+static uint8_t gatt_cache_entry_idx(const gatt_cache_entry_t* key);
+
+/* Returns the index of an unused entry, or of the next entry to replace
+** if there is none.
+*/
+static uint8_t gatt_cache_entry_alloc(void);
+
+/* Appends the given entry to the cache page, or rewrites the page from
+** the entries if it is full.
+*/
+static void gatt_cache_record_write(gatt_cache_entry_t* entry);
+
+// Erases the cache page and writes every entry in it.
+static void gatt_cache_page_rewrite(void);
+
+/*      CALLBACKS                                                   */
+
+// Write/erase result:  Logs failures.
+static void gatt_cache_fstorage_evt_handler(nrf_fstorage_evt_t* event);
+
+// Flash storage instance on the cache page.
+NRF_FSTORAGE_DEF(nrf_fstorage_t s_fstorage) =
+{
+    .evt_handler    = gatt_cache_fstorage_evt_handler,
+    .start_addr     = GATT_CACHE_PAGE_ADDR,
+    .end_addr       = GATT_CACHE_PAGE_ADDR + GATT_CACHE_PAGE_SIZE - 1,
+};
+
+void gatt_cache_init(void)
+{
+    if (s_initialized)
+    {
+        return;
+    }
+
+    memset(s_entries, 0, sizeof(s_entries));
+    memset(&s_stats, 0, sizeof(gatt_cache_stats_t));
+
+    s_next_record   = 0;
+    s_next_victim   = 0;
+
+    ret_code_t err_code = nrf_fstorage_init(&s_fstorage, &nrf_fstorage_sd,
+                                            NULL);
+    APP_ERROR_CHECK(err_code);
+
+    gatt_cache_load();
+
+    s_initialized = true;
+}
+
+uint32_t gatt_cache_hash(uint32_t hash, const void* data, uint16_t size)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+
+    for (uint16_t byte_idx = 0; byte_idx < size; byte_idx++)
+    {
+        hash ^= bytes[byte_idx];
+        hash *= GATT_CACHE_HASH_PRIME;
+    }
+
+    return hash;
+}
+
+bool gatt_cache_find(const ble_gap_addr_t* addr, uint32_t db_hash,
+                     uint16_t* handles, uint8_t nb_handles)
+{
+    gatt_cache_entry_t key;
+    gatt_cache_key_set(&key, addr, db_hash);
+
+    uint8_t entry_idx = gatt_cache_entry_idx(&key);
+    if ((entry_idx == GATT_CACHE_INVALID_IDX)
+        || (s_entries[entry_idx].nb_handles != nb_handles))
+    {
+        s_stats.miss_count++;
+        return false;
+    }
+
+    memcpy(handles, s_entries[entry_idx].handles,
+           nb_handles * sizeof(uint16_t));
+
+    s_stats.hit_count++;
+    return true;
+}
+
+void gatt_cache_store(const ble_gap_addr_t* addr, uint32_t db_hash,
+                      const uint16_t* handles, uint8_t nb_handles)
+{
+    if ((nb_handles == 0) || (nb_handles > GATT_CACHE_MAX_HANDLES))
+    {
+        return;
+    }
+
+    gatt_cache_entry_t key;
+    gatt_cache_key_set(&key, addr, db_hash);
+
+    uint8_t entry_idx = gatt_cache_entry_idx(&key);
+    if (entry_idx != GATT_CACHE_INVALID_IDX)
+    {
+        const gatt_cache_entry_t* entry = &(s_entries[entry_idx]);
+
+        if ((entry->nb_handles == nb_handles)
+            && (memcmp(entry->handles, handles,
+                       nb_handles * sizeof(uint16_t)) == 0))
+        {
+            // Already stored: spare the flash.
+            return;
+        }
+    }
+    else
+    {
+        entry_idx = gatt_cache_entry_alloc();
+    }
+
+    gatt_cache_entry_t* entry = &(s_entries[entry_idx]);
+
+    *entry = key;
+    entry->nb_handles = nb_handles;
+    memcpy(entry->handles, handles, nb_handles * sizeof(uint16_t));
+
+    gatt_cache_record_write(entry);
+}
+
+void gatt_cache_forget(const ble_gap_addr_t* addr, uint32_t db_hash)
+{
+    gatt_cache_entry_t key;
+    gatt_cache_key_set(&key, addr, db_hash);
+
+    uint8_t entry_idx = gatt_cache_entry_idx(&key);
+    if (entry_idx == GATT_CACHE_INVALID_IDX)
+    {
+        return;
+    }
+
+    gatt_cache_entry_t* entry = &(s_entries[entry_idx]);
+
+    // An unused entry is written as a removal record.
+    entry->nb_handles = 0;
+    memset(entry->handles, 0, sizeof(entry->handles));
+
+    gatt_cache_record_write(entry);
+}
+
+const gatt_cache_stats_t* gatt_cache_stats_get(void)
+{
+    return &s_stats;
+}
+
+static void gatt_cache_load(void)
+{
+    gatt_cache_entry_t record;
+
+    for (; s_next_record < GATT_CACHE_NB_RECORDS; s_next_record++)
+    {
+        uint32_t record_addr = GATT_CACHE_PAGE_ADDR
+                               + s_next_record * sizeof(gatt_cache_entry_t);
+
+        ret_code_t err_code = nrf_fstorage_read(&s_fstorage, record_addr,
+                                                &record,
+                                                sizeof(gatt_cache_entry_t));
+        APP_ERROR_CHECK(err_code);
+
+        if (record.tag != GATT_CACHE_RECORD_TAG)
+        {
+            // Erased flash: no more records.
+            break;
+        }
+
+        // Later records override earlier ones with the same key.
+        uint8_t entry_idx = gatt_cache_entry_idx(&record);
+        if (entry_idx == GATT_CACHE_INVALID_IDX)
+        {
+            if (record.nb_handles == 0)
+            {
+                continue;
+            }
+
+            entry_idx = gatt_cache_entry_alloc();
+        }
+
+        s_entries[entry_idx] = record;
+    }
+
+    #ifdef DEBUG
+    NRF_LOG_INFO("GATT cache: %u records loaded!", s_next_record);
+    #endif /* DEBUG */
+}
+
+static void gatt_cache_key_set(gatt_cache_entry_t* entry,
+                               const ble_gap_addr_t* addr,
+                               uint32_t db_hash)
+{
+    memset(entry, 0, sizeof(gatt_cache_entry_t));
+
+    entry->tag          = GATT_CACHE_RECORD_TAG;
+    entry->db_hash      = db_hash;
+    entry->addr_type    = addr->addr_type;
+    memcpy(entry->addr, addr->addr, BLE_GAP_ADDR_LEN);
+}
+
+static uint8_t gatt_cache_entry_idx(const gatt_cache_entry_t* key)
+{
+    for (uint8_t entry_idx = 0; entry_idx < GATT_CACHE_MAX_ENTRIES;
+         entry_idx++)
+    {
+        const gatt_cache_entry_t* entry = &(s_entries[entry_idx]);
+
+        if ((entry->nb_handles > 0)
+            && (entry->db_hash == key->db_hash)
+            && (entry->addr_type == key->addr_type)
+            && (memcmp(entry->addr, key->addr, BLE_GAP_ADDR_LEN) == 0))
+        {
+            return entry_idx;
+        }
+    }
+
+    return GATT_CACHE_INVALID_IDX;
+}
+
+static uint8_t gatt_cache_entry_alloc(void)
+{
+    for (uint8_t entry_idx = 0; entry_idx < GATT_CACHE_MAX_ENTRIES;
+         entry_idx++)
+    {
+        if (s_entries[entry_idx].nb_handles == 0)
+        {
+            return entry_idx;
+        }
+    }
+
+    uint8_t entry_idx = s_next_victim;
+    s_next_victim = (s_next_victim + 1) % GATT_CACHE_MAX_ENTRIES;
+
+    return entry_idx;
+}
+
+static void gatt_cache_record_write(gatt_cache_entry_t* entry)
+{
+    if (s_next_record >= GATT_CACHE_NB_RECORDS)
+    {
+        gatt_cache_page_rewrite();
+        return;
+    }
+
+    uint32_t record_addr = GATT_CACHE_PAGE_ADDR
+                           + s_next_record * sizeof(gatt_cache_entry_t);
+
+    ret_code_t err_code = nrf_fstorage_write(&s_fstorage, record_addr,
+                                             entry,
+                                             sizeof(gatt_cache_entry_t),
+                                             NULL);
+    if (err_code != NRF_SUCCESS)
+    {
+        // The entry stays in RAM only: the cache is an optimization.
+        #ifdef DEBUG
+        NRF_LOG_INFO("GATT cache: record not written (%u)!", err_code);
+        #endif /* DEBUG */
+        return;
+    }
+
+    s_next_record++;
+    s_stats.write_count++;
+}
+
+static void gatt_cache_page_rewrite(void)
+{
+    ret_code_t err_code = nrf_fstorage_erase(&s_fstorage,
+                                             GATT_CACHE_PAGE_ADDR, 1, NULL);
+    if (err_code != NRF_SUCCESS)
+    {
+        #ifdef DEBUG
+        NRF_LOG_INFO("GATT cache: page not erased (%u)!", err_code);
+        #endif /* DEBUG */
+        return;
+    }
+
+    // Entries never used become removal records of a null key.
+    for (uint8_t entry_idx = 0; entry_idx < GATT_CACHE_MAX_ENTRIES;
+         entry_idx++)
+    {
+        s_entries[entry_idx].tag = GATT_CACHE_RECORD_TAG;
+    }
+
+    err_code = nrf_fstorage_write(&s_fstorage, GATT_CACHE_PAGE_ADDR,
+                                  s_entries, sizeof(s_entries), NULL);
+    if (err_code != NRF_SUCCESS)
+    {
+        #ifdef DEBUG
+        NRF_LOG_INFO("GATT cache: page not rewritten (%u)!", err_code);
+        #endif /* DEBUG */
+        s_next_record = 0;
+        return;
+    }
+
+    s_next_record       = GATT_CACHE_MAX_ENTRIES;
+    s_stats.write_count += GATT_CACHE_MAX_ENTRIES;
+}
+
+static void gatt_cache_fstorage_evt_handler(nrf_fstorage_evt_t* event)
+{
+    if (event->result != NRF_SUCCESS)
+    {
+        #ifdef DEBUG
+        NRF_LOG_INFO("GATT cache: flash operation %u failed (%u)!",
+                     event->id, event->result);
+        #endif /* DEBUG */
+    }
+}
@@ -0,0 +1,108 @@
+#ifndef GATT_CACHE_H
+#define GATT_CACHE_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+
+// NRF
+#include "nrf_sdh_ble.h"    // NRF_SDH_BLE_CENTRAL_LINK_COUNT
+
+// SOFTDEVICE
+#include "ble_gap.h"        // ble_gap_addr_t, BLE_GAP_ADDR_LEN
+
+/*      CONSTANTS                                                   */
+
+/* The GATT cache keeps the handles discovered on the servers, so that a
+** client reconnecting to a known server can use them right away instead
+** of running the DB discovery again.
+**
+** Entries are keyed by the peer address and by a hash of the layout the
+** client expects: a client looking for other services or
+** characteristics changes its hash, and never gets handles discovered
+** for another layout. A client finding out that cached handles are stale
+** shall forget them.
+**
+** Entries are kept in RAM and appended to a dedicated flash page through
+** fstorage. The page is erased and rewritten from RAM when full. All the
+** functions shall be called from the BLE events context.
+*/
+
+// Flash page holding the cache, below the pages of the HAL flash module.
+#define GATT_CACHE_PAGE_ADDR    0x7D000
+#define GATT_CACHE_PAGE_SIZE    0x1000
+
+// Maximum number of handles in an entry.
+#define GATT_CACHE_MAX_HANDLES  6
+
+// Maximum number of entries: two services on each central link.
+#define GATT_CACHE_MAX_ENTRIES  (2 * NRF_SDH_BLE_CENTRAL_LINK_COUNT)
+
+// Initial value of a layout hash.
+#define GATT_CACHE_HASH_INIT    0x811C9DC5
+
+// Cache entry, stored as is in flash.
+typedef struct
+{
+    // GATT_CACHE_RECORD_TAG once written in flash.
+    uint32_t    tag;
+
+    // Hash of the layout expected by the client.
+    uint32_t    db_hash;
+
+    // Peer address.
+    uint8_t     addr_type;
+    uint8_t     addr[BLE_GAP_ADDR_LEN];
+
+    // Number of handles, 0 if the entry is unused.
+    uint8_t     nb_handles;
+
+    // Handles, in the order chosen by the client.
+    uint16_t    handles[GATT_CACHE_MAX_HANDLES];
+} gatt_cache_entry_t;
+
+// Cache statistics.
+typedef struct
+{
+    // Number of lookups which found an entry.
+    uint32_t    hit_count;
+
+    // Number of lookups which did not.
+    uint32_t    miss_count;
+
+    // Number of records written in flash, erases excluded.
+    uint32_t    write_count;
+} gatt_cache_stats_t;
+
+/* Initializes fstorage on the cache page and loads the stored entries.
+** Can be called by each client: only the first call has an effect.
+*/
+void gatt_cache_init(void);
+
+/* Returns the given layout hash updated with the given data. A client
+** hashes the UUIDs it looks for, starting from GATT_CACHE_HASH_INIT.
+*/
+uint32_t gatt_cache_hash(uint32_t hash, const void* data, uint16_t size);
+
+/* Copies in `handles` the `nb_handles` handles stored for the given peer
+** and layout. Returns false if there are none.
+*/
+bool gatt_cache_find(const ble_gap_addr_t* addr, uint32_t db_hash,
+                     uint16_t* handles, uint8_t nb_handles);
+
+/* Stores the given handles for the given peer and layout, replacing the
+** oldest entry if the cache is full. Nothing is written in flash if the
+** same handles are already stored.
+*/
+void gatt_cache_store(const ble_gap_addr_t* addr, uint32_t db_hash,
+                      const uint16_t* handles, uint8_t nb_handles);
+
+// Removes the handles stored for the given peer and layout.
+void gatt_cache_forget(const ble_gap_addr_t* addr, uint32_t db_hash);
+
+// Returns the cache statistics.
+const gatt_cache_stats_t* gatt_cache_stats_get(void);
+
+#endif /* ! GATT_CACHE_H */
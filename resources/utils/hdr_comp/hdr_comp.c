@@ -0,0 +1,245 @@
+#include "hdr_comp.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>    // bool
+#include <stddef.h>     // NULL
+#include <stdint.h>     // uint*_t
+#include <string.h>     // memcpy, memset
+
+#ifdef DEBUG
+#include "nrf_log.h"    // NRF_LOG_INFO
+#endif /* DEBUG */
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Index returned when no context matches.
+#define HDR_COMP_INVALID_IDX    UINT8_MAX
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Returns the index of the set context of the given instance having the
+** key of the given header, and stores in `nb_changed` the number of
+** bytes they differ by. Returns HDR_COMP_INVALID_IDX if there is none.
+*/
+static uint8_t hdr_comp_flow_find(const hdr_comp_t* comp,
+                                  const uint8_t* hdr, uint8_t* nb_changed);
+
+/* Returns the index of an unset context of the given instance, or of its
+** least recently used one if all are set.
+*/
+static uint8_t hdr_comp_victim(const hdr_comp_t* comp);
+
+void hdr_comp_init(hdr_comp_t* comp, uint8_t hdr_size, uint8_t key_size)
+{
+    if (hdr_size > HDR_COMP_MAX_HDR_SIZE)
+    {
+        #ifdef DEBUG
+        NRF_LOG_INFO("Header too large: only %u bytes compressed!",
+                     HDR_COMP_MAX_HDR_SIZE);
+        #endif /* DEBUG */
+
+        hdr_size = HDR_COMP_MAX_HDR_SIZE;
+    }
+
+    comp->hdr_size = hdr_size;
+    comp->key_size = (key_size < hdr_size) ? key_size : hdr_size;
+    memset(&(comp->stats), 0, sizeof(hdr_comp_stats_t));
+
+    hdr_comp_reset(comp);
+}
+
+void hdr_comp_reset(hdr_comp_t* comp)
+{
+    memset(comp->contexts, 0, sizeof(comp->contexts));
+    memset(comp->last_use, 0, sizeof(comp->last_use));
+
+    comp->clock = 0;
+}
+
+uint8_t hdr_comp_encode(hdr_comp_t* comp, const uint8_t* hdr,
+                        uint8_t* out)
+{
+    uint8_t hdr_size    = comp->hdr_size;
+    uint8_t nb_changed  = 0;
+    uint8_t ctx_idx     = hdr_comp_flow_find(comp, hdr, &nb_changed);
+    uint8_t size        = 1;
+
+    if ((ctx_idx != HDR_COMP_INVALID_IDX) && (nb_changed == 0))
+    {
+        out[0] = HDR_COMP_HIT | ctx_idx;
+        comp->stats.hit_count++;
+    }
+    else if ((ctx_idx != HDR_COMP_INVALID_IDX)
+             && (2 + nb_changed < 1 + hdr_size))
+    {
+        uint8_t* context    = comp->contexts[ctx_idx];
+        uint8_t  mask       = 0;
+
+        size = 2;
+        for (uint8_t byte_idx = 0; byte_idx < hdr_size; byte_idx++)
+        {
+            if (hdr[byte_idx] != context[byte_idx])
+            {
+                mask |= (1 << byte_idx);
+                out[size++] = hdr[byte_idx];
+            }
+        }
+
+        out[0] = HDR_COMP_DELTA | ctx_idx;
+        out[1] = mask;
+        comp->stats.delta_count++;
+    }
+    else
+    {
+        if (ctx_idx == HDR_COMP_INVALID_IDX)
+        {
+            // New flow.
+            ctx_idx = hdr_comp_victim(comp);
+        }
+
+        out[0] = HDR_COMP_FULL | ctx_idx;
+        memcpy(out + 1, hdr, hdr_size);
+        size += hdr_size;
+        comp->stats.full_count++;
+    }
+
+    memcpy(comp->contexts[ctx_idx], hdr, hdr_size);
+    comp->last_use[ctx_idx] = ++(comp->clock);
+
+    comp->stats.raw_bytes   += hdr_size;
+    comp->stats.comp_bytes  += size;
+
+    return size;
+}
+
+uint8_t hdr_comp_decode(hdr_comp_t* comp, const uint8_t* data,
+                        uint16_t size, uint8_t* hdr)
+{
+    if (size == 0)
+    {
+        comp->stats.error_count++;
+        return 0;
+    }
+
+    uint8_t hdr_size    = comp->hdr_size;
+    uint8_t mode        = data[0] & HDR_COMP_MODE_MASK;
+    uint8_t ctx_idx     = data[0] & HDR_COMP_IDX_MASK;
+    uint8_t comp_size   = 1;
+
+    bool valid = (ctx_idx < HDR_COMP_NB_CONTEXTS)
+                 && ((mode == HDR_COMP_FULL)
+                     || (comp->last_use[ctx_idx] != 0));
+
+    uint8_t* context = valid ? comp->contexts[ctx_idx] : NULL;
+
+    if (valid && (mode == HDR_COMP_FULL))
+    {
+        comp_size += hdr_size;
+        valid = (size >= comp_size);
+        if (valid)
+        {
+            memcpy(context, data + 1, hdr_size);
+            comp->stats.full_count++;
+        }
+    }
+    else if (valid && (mode == HDR_COMP_DELTA))
+    {
+        comp_size++;
+        valid = (size >= comp_size);
+
+        // Bytes beyond the header cannot change.
+        uint8_t mask = valid ? data[1] : 0;
+        valid = valid && ((mask >> hdr_size) == 0);
+
+        for (uint8_t byte_idx = 0; valid && (byte_idx < hdr_size);
+             byte_idx++)
+        {
+            if (mask & (1 << byte_idx))
+            {
+                valid = (size > comp_size);
+                if (valid)
+                {
+                    context[byte_idx] = data[comp_size++];
+                }
+            }
+        }
+
+        if (valid)
+        {
+            comp->stats.delta_count++;
+        }
+    }
+    else if (valid && (mode == HDR_COMP_HIT))
+    {
+        comp->stats.hit_count++;
+    }
+    else
+    {
+        valid = false;
+    }
+
+    if (!valid)
+    {
+        // A partially applied delta leaves the context unusable.
+        if (ctx_idx < HDR_COMP_NB_CONTEXTS)
+        {
+            comp->last_use[ctx_idx] = 0;
+        }
+
+        comp->stats.error_count++;
+        return 0;
+    }
+
+    memcpy(hdr, context, hdr_size);
+    comp->last_use[ctx_idx] = ++(comp->clock);
+
+    comp->stats.raw_bytes   += hdr_size;
+    comp->stats.comp_bytes  += comp_size;
+
+    return comp_size;
+}
+
+static uint8_t hdr_comp_flow_find(const hdr_comp_t* comp,
+                                  const uint8_t* hdr, uint8_t* nb_changed)
+{
+    for (uint8_t ctx_idx = 0; ctx_idx < HDR_COMP_NB_CONTEXTS; ctx_idx++)
+    {
+        const uint8_t* context = comp->contexts[ctx_idx];
+
+        if ((comp->last_use[ctx_idx] == 0)
+            || (memcmp(context, hdr, comp->key_size) != 0))
+        {
+            continue;
+        }
+
+        uint8_t count = 0;
+        for (uint8_t byte_idx = comp->key_size; byte_idx < comp->hdr_size;
+             byte_idx++)
+        {
+            count += (hdr[byte_idx] != context[byte_idx]);
+        }
+
+        *nb_changed = count;
+        return ctx_idx;
+    }
+
+    *nb_changed = comp->hdr_size;
+    return HDR_COMP_INVALID_IDX;
+}
+
+static uint8_t hdr_comp_victim(const hdr_comp_t* comp)
+{
+    uint8_t victim_idx = 0;
+
+    for (uint8_t ctx_idx = 0; ctx_idx < HDR_COMP_NB_CONTEXTS; ctx_idx++)
+    {
+        if (comp->last_use[ctx_idx] < comp->last_use[victim_idx])
+        {
+            victim_idx = ctx_idx;
+        }
+    }
+
+    return victim_idx;
+}
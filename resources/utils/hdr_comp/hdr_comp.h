@@ -0,0 +1,113 @@
+#ifndef HDR_COMP_H
+#define HDR_COMP_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdint.h>     // uint*_t
+
+/*      DEFINES                                                     */
+
+/* Link-local compression of the fixed-size headers of the messages sent
+** over the BLE link. Both ends hold the same table of contexts, each one
+** the last header sent through it. Every compressed header starts with a
+** token byte:
+** -    bits 6-7:   mode,
+** -    bits 0-5:   index of the context used.
+** Modes:
+** -    full:   the whole header follows, and replaces the context,
+** -    delta:  a mask of the changed bytes follows, then these bytes,
+**              and the result replaces the context,
+** -    hit:    the header is the context itself.
+** The sender keeps one context per flow, identified by the first
+** `key_size` bytes of the header (source, target, command...). A header
+** of a known flow is sent as a hit or as a delta of its other bytes, such
+** as its data size. The header of a new flow is sent in full, and
+** replaces the least recently used context. The receiver does not need
+** the key: it applies what the sender decided.
+** Both ends shall reset their contexts whenever the link is
+** (re)established: a full header is then sent for each new context.
+*/
+
+// Maximum size of a header: one bit per byte in the delta mask.
+#define HDR_COMP_MAX_HDR_SIZE   8
+
+// Number of contexts.
+#define HDR_COMP_NB_CONTEXTS    16
+
+// Maximum size of a compressed header.
+#define HDR_COMP_MAX_SIZE       (1 + HDR_COMP_MAX_HDR_SIZE)
+
+// Token modes.
+#define HDR_COMP_FULL           0x00
+#define HDR_COMP_DELTA          0x40
+#define HDR_COMP_HIT            0x80
+
+// Masks of the token fields.
+#define HDR_COMP_MODE_MASK      0xC0
+#define HDR_COMP_IDX_MASK       0x3F
+
+// Compression statistics.
+typedef struct
+{
+    // Number of headers per mode.
+    uint32_t    full_count;
+    uint32_t    delta_count;
+    uint32_t    hit_count;
+
+    // Number of header bytes before and after compression.
+    uint32_t    raw_bytes;
+    uint32_t    comp_bytes;
+
+    // Number of compressed headers which could not be decoded.
+    uint32_t    error_count;
+
+} hdr_comp_stats_t;
+
+// Compression instance, for one direction of a link.
+typedef struct
+{
+    // Size of the headers.
+    uint8_t             hdr_size;
+
+    // Size of the key identifying the flow of a header, at its beginning.
+    uint8_t             key_size;
+
+    // Contexts.
+    uint8_t             contexts[HDR_COMP_NB_CONTEXTS]
+                                [HDR_COMP_MAX_HDR_SIZE];
+
+    // Last use of each context, 0 if it is not set.
+    uint32_t            last_use[HDR_COMP_NB_CONTEXTS];
+
+    // Incremented on every header.
+    uint32_t            clock;
+
+    // Statistics.
+    hdr_comp_stats_t    stats;
+
+} hdr_comp_t;
+
+/* Initializes the given instance for headers of `hdr_size` bytes, at
+** most HDR_COMP_MAX_HDR_SIZE, starting with a flow key of `key_size`
+** bytes.
+*/
+void hdr_comp_init(hdr_comp_t* comp, uint8_t hdr_size, uint8_t key_size);
+
+// Unsets the contexts of the given instance, keeping its statistics.
+void hdr_comp_reset(hdr_comp_t* comp);
+
+/* Compresses the given header in `out`, which shall hold
+** HDR_COMP_MAX_SIZE bytes. Returns the size of the compressed header.
+*/
+uint8_t hdr_comp_encode(hdr_comp_t* comp, const uint8_t* hdr,
+                        uint8_t* out);
+
+/* Decompresses the header at the beginning of the given data in `hdr`.
+** Returns the size of the compressed header, or 0 if it is invalid: the
+** link shall then be reset.
+*/
+uint8_t hdr_comp_decode(hdr_comp_t* comp, const uint8_t* data,
+                        uint16_t size, uint8_t* hdr);
+
+#endif /* ! HDR_COMP_H */
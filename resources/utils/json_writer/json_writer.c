@@ -0,0 +1,295 @@
+#include "json_writer.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <math.h>       // isfinite
+#include <stdbool.h>    // bool
+#include <stdint.h>     // uint*_t, int32_t, INT32_MAX, INT32_MIN
+#include <stdio.h>      // snprintf, sscanf
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Size of the largest formatted number, "%1.17g" of a double included.
+#define NUMBER_STRING_SIZE  32
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Writes the separator preceding a value at the current depth, and its
+** key if any.
+*/
+static void value_begin(json_writer_t* writer, const char* key);
+
+// Opens an object or array with the given opening character.
+static void container_begin(json_writer_t* writer, const char* key,
+                            char opening);
+
+// Closes the last open object or array with the given closing character.
+static void container_end(json_writer_t* writer, char closing);
+
+// Writes the given string between quotes, escaped.
+static void string_put(json_writer_t* writer, const char* string);
+
+// Writes the given string as is.
+static void raw_put(json_writer_t* writer, const char* string);
+
+// Stages the given byte, flushing the buffer first if it is full.
+static void byte_put(json_writer_t* writer, uint8_t byte);
+
+// Hands the staged output to the flush function.
+static void buffer_flush(json_writer_t* writer);
+
+void json_writer_object_begin(json_writer_t* writer, const char* key)
+{
+    container_begin(writer, key, '{');
+}
+
+void json_writer_object_end(json_writer_t* writer)
+{
+    container_end(writer, '}');
+}
+
+void json_writer_array_begin(json_writer_t* writer, const char* key)
+{
+    container_begin(writer, key, '[');
+}
+
+void json_writer_array_end(json_writer_t* writer)
+{
+    container_end(writer, ']');
+}
+
+void json_writer_string(json_writer_t* writer, const char* key,
+                        const char* value)
+{
+    value_begin(writer, key);
+
+    if (value == NULL)
+    {
+        raw_put(writer, "null");
+        return;
+    }
+
+    string_put(writer, value);
+}
+
+void json_writer_number(json_writer_t* writer, const char* key,
+                        double value)
+{
+    value_begin(writer, key);
+
+    if (!isfinite(value))
+    {
+        raw_put(writer, "null");
+        return;
+    }
+
+    // Same saturated integer conversion as cJSON.
+    int32_t int_value;
+    if (value >= INT32_MAX)
+    {
+        int_value = INT32_MAX;
+    }
+    else if (value <= INT32_MIN)
+    {
+        int_value = INT32_MIN;
+    }
+    else
+    {
+        int_value = (int32_t)value;
+    }
+
+    char number[NUMBER_STRING_SIZE];
+    if (value == (double)int_value)
+    {
+        snprintf(number, sizeof(number), "%ld", (long)int_value);
+    }
+    else
+    {
+        // 15 digits are enough unless the value does not read back.
+        double read_value;
+        snprintf(number, sizeof(number), "%1.15g", value);
+        if ((sscanf(number, "%lg", &read_value) != 1)
+            || (read_value != value))
+        {
+            snprintf(number, sizeof(number), "%1.17g", value);
+        }
+    }
+
+    raw_put(writer, number);
+}
+
+void json_writer_int(json_writer_t* writer, const char* key,
+                     int32_t value)
+{
+    value_begin(writer, key);
+
+    char number[NUMBER_STRING_SIZE];
+    snprintf(number, sizeof(number), "%ld", (long)value);
+
+    raw_put(writer, number);
+}
+
+void json_writer_bool(json_writer_t* writer, const char* key,
+                      bool value)
+{
+    value_begin(writer, key);
+    raw_put(writer, value ? "true" : "false");
+}
+
+void json_writer_null(json_writer_t* writer, const char* key)
+{
+    value_begin(writer, key);
+    raw_put(writer, "null");
+}
+
+bool json_writer_end(json_writer_t* writer)
+{
+    if (writer->depth != 0)
+    {
+        // Some objects or arrays were not closed.
+        writer->error = true;
+    }
+
+    buffer_flush(writer);
+
+    bool success = !writer->error;
+
+    writer->depth       = 0;
+    writer->not_first   = 0;
+    writer->error       = false;
+
+    return success;
+}
+
+static void value_begin(json_writer_t* writer, const char* key)
+{
+    uint32_t depth_mask = 1UL << writer->depth;
+
+    if (writer->not_first & depth_mask)
+    {
+        byte_put(writer, ',');
+    }
+    writer->not_first |= depth_mask;
+
+    if (key != NULL)
+    {
+        string_put(writer, key);
+        byte_put(writer, ':');
+    }
+}
+
+static void container_begin(json_writer_t* writer, const char* key,
+                            char opening)
+{
+    value_begin(writer, key);
+
+    if (writer->depth + 1 >= JSON_WRITER_MAX_DEPTH)
+    {
+        // Nesting too deep to track the separators.
+        writer->error = true;
+        return;
+    }
+
+    byte_put(writer, opening);
+
+    writer->depth++;
+    writer->not_first &= ~(1UL << writer->depth);
+}
+
+static void container_end(json_writer_t* writer, char closing)
+{
+    if (writer->depth == 0)
+    {
+        // Nothing to close.
+        writer->error = true;
+        return;
+    }
+
+    writer->depth--;
+    byte_put(writer, closing);
+}
+
+static void string_put(json_writer_t* writer, const char* string)
+{
+    byte_put(writer, '\"');
+
+    for (const char* character = string; *character != '\0'; character++)
+    {
+        uint8_t byte = (uint8_t)*character;
+
+        switch (byte)
+        {
+        case '\"':
+            raw_put(writer, "\\\"");
+            break;
+        case '\\':
+            raw_put(writer, "\\\\");
+            break;
+        case '\b':
+            raw_put(writer, "\\b");
+            break;
+        case '\f':
+            raw_put(writer, "\\f");
+            break;
+        case '\n':
+            raw_put(writer, "\\n");
+            break;
+        case '\r':
+            raw_put(writer, "\\r");
+            break;
+        case '\t':
+            raw_put(writer, "\\t");
+            break;
+        default:
+            if (byte < ' ')
+            {
+                // Other control characters are written as code points.
+                char escaped[sizeof("\\u0000")];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", byte);
+                raw_put(writer, escaped);
+            }
+            else
+            {
+                byte_put(writer, byte);
+            }
+            break;
+        }
+    }
+
+    byte_put(writer, '\"');
+}
+
+static void raw_put(json_writer_t* writer, const char* string)
+{
+    for (const char* character = string; *character != '\0'; character++)
+    {
+        byte_put(writer, (uint8_t)*character);
+    }
+}
+
+static void byte_put(json_writer_t* writer, uint8_t byte)
+{
+    if (writer->size == writer->buffer_size)
+    {
+        buffer_flush(writer);
+    }
+
+    writer->buffer[writer->size++] = byte;
+}
+
+static void buffer_flush(json_writer_t* writer)
+{
+    if (writer->size == 0)
+    {
+        // Nothing to send.
+        return;
+    }
+
+    if (!writer->flush(writer->buffer, writer->size))
+    {
+        writer->error = true;
+    }
+
+    writer->size = 0;
+}
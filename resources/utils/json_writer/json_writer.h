@@ -0,0 +1,109 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>    // bool
+#include <stdint.h>     // uint*_t, int32_t
+
+/*      DEFINES                                                     */
+
+/* The writer emits compact JSON, formatted like `cJSON_PrintUnformatted`,
+** as the document is walked: no tree is built and no memory is
+** allocated. Output is staged in a fixed buffer, which is handed to the
+** flush function whenever it is full and when the document ends.
+**
+** Each value is written with a key when it is a member of an object,
+** and with a NULL key otherwise.
+*/
+
+// Maximum nesting depth of a document.
+#define JSON_WRITER_MAX_DEPTH   32
+
+/* Defines a writer instance staging its output in a buffer of
+** `_buffer_size` bytes, and handing it to the given flush function.
+*/
+#define JSON_WRITER_DEF(_name, _buffer_size, _flush)                    \
+    static uint8_t _name ## _buffer[_buffer_size];                      \
+    static json_writer_t _name =                                        \
+    {                                                                   \
+        .buffer         = _name ## _buffer,                             \
+        .buffer_size    = (_buffer_size),                               \
+        .flush          = (_flush),                                     \
+    }/*;*/
+
+/* Sends the given staged output. Returns false if it could not be sent
+** entirely.
+*/
+typedef bool (*json_writer_flush_t)(const uint8_t* data, uint16_t size);
+
+// JSON writer instance.
+typedef struct
+{
+    // Staged output.
+    uint8_t*            buffer;
+
+    // Size of the buffer in bytes.
+    uint16_t            buffer_size;
+
+    // Number of staged bytes.
+    uint16_t            size;
+
+    // Function sending the staged output.
+    json_writer_flush_t flush;
+
+    // Number of objects and arrays currently open.
+    uint8_t             depth;
+
+    /* Bit `n` is set if a value was already written at depth `n`, so
+    ** that the next one is preceded by a comma.
+    */
+    uint32_t            not_first;
+
+    // True if the output could not be sent or the document is invalid.
+    bool                error;
+
+} json_writer_t;
+
+// Opens an object.
+void json_writer_object_begin(json_writer_t* writer, const char* key);
+
+// Closes the last open object.
+void json_writer_object_end(json_writer_t* writer);
+
+// Opens an array.
+void json_writer_array_begin(json_writer_t* writer, const char* key);
+
+// Closes the last open array.
+void json_writer_array_end(json_writer_t* writer);
+
+// Writes a string, escaped.
+void json_writer_string(json_writer_t* writer, const char* key,
+                        const char* value);
+
+/* Writes a number, with the shortest of 15 or 17 significant digits
+** which reads back as the same value. Integral values are written as
+** integers, and non-finite ones as null.
+*/
+void json_writer_number(json_writer_t* writer, const char* key,
+                        double value);
+
+// Writes an integer.
+void json_writer_int(json_writer_t* writer, const char* key,
+                     int32_t value);
+
+// Writes a boolean.
+void json_writer_bool(json_writer_t* writer, const char* key,
+                      bool value);
+
+// Writes a null value.
+void json_writer_null(json_writer_t* writer, const char* key);
+
+/* Flushes the end of the document, and resets the writer for the next
+** one. Returns false if the output could not be sent entirely or if the
+** document was invalid.
+*/
+bool json_writer_end(json_writer_t* writer);
+
+#endif /* ! JSON_WRITER_H */
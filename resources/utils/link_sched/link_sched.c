@@ -0,0 +1,150 @@
+#include "link_sched.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stddef.h>         // NULL
+#include <string.h>         // memset
+
+// SOFTDEVICE
+#include "ble_types.h"      // BLE_CONN_HANDLE_INVALID
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Maximum number of links, as bits of the busy links mask.
+#define LINK_SCHED_MAX_LINKS    32
+
+/*      STATIC FUNCTIONS                                            */
+
+// Resets the queue and statistics of the given link of the given scheduler.
+static void link_sched_link_reset(link_sched_t* sched, uint8_t link_idx,
+                                  uint16_t conn_handle);
+
+void link_sched_init(link_sched_t* sched)
+{
+    if (sched->nb_links > LINK_SCHED_MAX_LINKS)
+    {
+        sched->nb_links = LINK_SCHED_MAX_LINKS;
+    }
+
+    for (uint8_t link_idx = 0; link_idx < sched->nb_links; link_idx++)
+    {
+        link_sched_link_reset(sched, link_idx, BLE_CONN_HANDLE_INVALID);
+    }
+
+    sched->next_link = 0;
+}
+
+uint8_t link_sched_link_add(link_sched_t* sched, uint16_t conn_handle)
+{
+    uint8_t link_idx = link_sched_link_idx(sched, BLE_CONN_HANDLE_INVALID);
+    if (link_idx != LINK_SCHED_INVALID_IDX)
+    {
+        link_sched_link_reset(sched, link_idx, conn_handle);
+    }
+
+    return link_idx;
+}
+
+void link_sched_link_remove(link_sched_t* sched, uint16_t conn_handle)
+{
+    uint8_t link_idx = link_sched_link_idx(sched, conn_handle);
+    if (link_idx == LINK_SCHED_INVALID_IDX)
+    {
+        return;
+    }
+
+    link_sched_link_t* link = &(sched->links[link_idx]);
+
+    link->conn_handle = BLE_CONN_HANDLE_INVALID;
+    msg_queue_inst_pop_n(&(link->queue), msg_queue_inst_count(&(link->queue)));
+}
+
+uint8_t link_sched_link_idx(const link_sched_t* sched, uint16_t conn_handle)
+{
+    for (uint8_t link_idx = 0; link_idx < sched->nb_links; link_idx++)
+    {
+        if (sched->links[link_idx].conn_handle == conn_handle)
+        {
+            return link_idx;
+        }
+    }
+
+    return LINK_SCHED_INVALID_IDX;
+}
+
+bool link_sched_enqueue(link_sched_t* sched, uint16_t conn_handle,
+                        const uint8_t* data, uint16_t size)
+{
+    if (conn_handle == BLE_CONN_HANDLE_INVALID)
+    {
+        return false;
+    }
+
+    uint8_t link_idx = link_sched_link_idx(sched, conn_handle);
+    if (link_idx == LINK_SCHED_INVALID_IDX)
+    {
+        return false;
+    }
+
+    return msg_queue_inst_enqueue(&(sched->links[link_idx].queue), data, size);
+}
+
+uint16_t link_sched_run(link_sched_t* sched, uint16_t max_count)
+{
+    uint16_t    nb_sent     = 0;
+    uint32_t    busy_links  = 0;
+    uint8_t     link_idx    = sched->next_link;
+
+    // Stop once a whole turn over the links sent nothing.
+    uint8_t     nb_idle     = 0;
+
+    while ((nb_sent < max_count) && (nb_idle < sched->nb_links))
+    {
+        link_sched_link_t*  link = &(sched->links[link_idx]);
+        bool                sent = false;
+
+        if ((link->conn_handle != BLE_CONN_HANDLE_INVALID)
+            && ((busy_links & (1UL << link_idx)) == 0))
+        {
+            tx_buffer_t* msg = msg_queue_inst_peek(&(link->queue));
+            if (msg != NULL)
+            {
+                sent = sched->send(link->conn_handle, msg->buffer,
+                                   msg->size);
+                if (sent)
+                {
+                    msg_queue_inst_pop(&(link->queue));
+                    link->stats.sent_count++;
+                    nb_sent++;
+                }
+                else
+                {
+                    // Skip the link until the next run.
+                    busy_links |= (1UL << link_idx);
+                    link->stats.busy_count++;
+                }
+            }
+        }
+
+        nb_idle     = sent ? 0 : nb_idle + 1;
+        link_idx    = (link_idx + 1) % sched->nb_links;
+    }
+
+    sched->next_link = link_idx;
+
+    return nb_sent;
+}
+
+static void link_sched_link_reset(link_sched_t* sched, uint8_t link_idx,
+                                  uint16_t conn_handle)
+{
+    link_sched_link_t* link = &(sched->links[link_idx]);
+
+    memset(link, 0, sizeof(link_sched_link_t));
+
+    link->conn_handle       = conn_handle;
+    link->queue.ring        = sched->rings + link_idx * sched->ring_size;
+    link->queue.ring_size   = sched->ring_size;
+    link->queue.slot_size   = sched->slot_size;
+}
@@ -0,0 +1,133 @@
+#ifndef LINK_SCHED_H
+#define LINK_SCHED_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+
+// CUSTOM
+#include "msg_queue.h"      // msg_queue_t, MSG_QUEUE_RING_SIZE
+
+/*      CONSTANTS                                                   */
+
+/* A link scheduler holds one message queue per connection, and sends
+** their messages in turn, one message per link at a time. A link which
+** cannot take a message is skipped until the next run, so that a slow
+** node cannot stall the others.
+**
+** Enqueuing is the producer side of the queues, adding and removing
+** links and running the scheduler are the consumer side: see msg_queue.
+** BLE event handlers run in interrupt context: they shall only flag the
+** links to add or remove, and let the context running the scheduler
+** apply them before its next run.
+*/
+
+// Index returned when a connection has no link.
+#define LINK_SCHED_INVALID_IDX  UINT8_MAX
+
+/* Defines a link scheduler instance able to serve `_nb_links`
+** connections, each with a queue of `_depth` messages of `_slot_size`
+** bytes, sending messages with the given function.
+*/
+#define LINK_SCHED_DEF(_name, _nb_links, _depth, _slot_size, _send)     \
+    static uint8_t _name ## _rings[(_nb_links)                          \
+                                   * MSG_QUEUE_RING_SIZE(_depth,        \
+                                                         _slot_size)];  \
+    static link_sched_link_t _name ## _links[_nb_links];                \
+    static link_sched_t _name =                                         \
+    {                                                                   \
+        .links      = _name ## _links,                                  \
+        .nb_links   = (_nb_links),                                      \
+        .rings      = _name ## _rings,                                  \
+        .ring_size  = MSG_QUEUE_RING_SIZE(_depth, _slot_size),          \
+        .slot_size  = (_slot_size),                                     \
+        .send       = (_send),                                          \
+    }/*;*/
+
+/* Sends the given message on the given connection. Returns false if the
+** connection cannot take it now.
+*/
+typedef bool(*link_sched_send_t)(uint16_t conn_handle, const uint8_t* data,
+                                 uint16_t size);
+
+// Statistics of a link, for fairness measurements.
+typedef struct
+{
+    // Number of sent messages.
+    uint32_t    sent_count;
+
+    // Number of times the link could not take a message.
+    uint32_t    busy_count;
+} link_sched_stats_t;
+
+// Link served by a scheduler.
+typedef struct
+{
+    // Connection handle, or BLE_CONN_HANDLE_INVALID if unused.
+    uint16_t            conn_handle;
+
+    // Queue of the messages to send on the link.
+    msg_queue_t         queue;
+
+    // Statistics.
+    link_sched_stats_t  stats;
+} link_sched_link_t;
+
+// Link scheduler instance.
+typedef struct
+{
+    // Links.
+    link_sched_link_t*  links;
+
+    // Number of links.
+    uint8_t             nb_links;
+
+    // Storage of the link queues, one ring after the other.
+    uint8_t*            rings;
+
+    // Size of the storage of a link queue in bytes.
+    uint16_t            ring_size;
+
+    // Maximum size of a message in bytes.
+    uint16_t            slot_size;
+
+    // Function sending the messages.
+    link_sched_send_t   send;
+
+    // Link served first at the next run.
+    uint8_t             next_link;
+} link_sched_t;
+
+// Initializes the given link scheduler instance, with no link.
+void link_sched_init(link_sched_t* sched);
+
+/* Assigns a free link of the given scheduler to the given connection, and
+** returns its index, or LINK_SCHED_INVALID_IDX if no link is free.
+*/
+uint8_t link_sched_link_add(link_sched_t* sched, uint16_t conn_handle);
+
+/* Frees the link of the given connection in the given scheduler, dropping
+** its pending messages.
+*/
+void link_sched_link_remove(link_sched_t* sched, uint16_t conn_handle);
+
+/* Returns the index of the link of the given connection in the given
+** scheduler, or LINK_SCHED_INVALID_IDX if it has none.
+*/
+uint8_t link_sched_link_idx(const link_sched_t* sched, uint16_t conn_handle);
+
+/* Enqueues the given message for the given connection. Returns true if
+** the operation could be performed, false otherwise.
+*/
+bool link_sched_enqueue(link_sched_t* sched, uint16_t conn_handle,
+                        const uint8_t* data, uint16_t size);
+
+/* Sends the pending messages in turn over the links, until every link is
+** either empty or busy, or `max_count` messages were sent. Returns the
+** number of sent messages.
+*/
+uint16_t link_sched_run(link_sched_t* sched, uint16_t max_count);
+
+#endif /* ! LINK_SCHED_H */
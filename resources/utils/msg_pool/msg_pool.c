@@ -0,0 +1,175 @@
+#include "msg_pool.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>    // bool
+#include <stddef.h>     // NULL
+#include <string.h>     // memset
+
+#ifdef DEBUG
+#include "nrf_log.h"    // NRF_LOG_INFO
+#endif /* DEBUG */
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Next block of a used block.
+#define MSG_POOL_USED   UINT16_MAX
+
+// Next block of the last free block.
+#define MSG_POOL_END    (UINT16_MAX - 1)
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Takes a block from the given class of the given pool. Returns NULL if
+** the class has no free block.
+*/
+static void* msg_pool_class_take(msg_pool_t* pool, msg_pool_class_t* cls);
+
+void msg_pool_init(msg_pool_t* pool)
+{
+    for (uint8_t class_idx = 0; class_idx < pool->nb_classes; class_idx++)
+    {
+        msg_pool_class_t* cls = pool->classes[class_idx];
+
+        for (uint16_t block_idx = 0; block_idx < cls->nb_blocks;
+             block_idx++)
+        {
+            cls->blocks[block_idx].next = block_idx + 1;
+        }
+
+        if (cls->nb_blocks > 0)
+        {
+            cls->blocks[cls->nb_blocks - 1].next = MSG_POOL_END;
+        }
+
+        cls->free_head = (cls->nb_blocks > 0) ? 0 : MSG_POOL_END;
+        memset(&(cls->stats), 0, sizeof(msg_pool_class_stats_t));
+    }
+
+    pool->drop_count = 0;
+}
+
+void* msg_pool_alloc(msg_pool_t* pool, uint16_t size)
+{
+    bool spilled = false;
+
+    for (uint8_t class_idx = 0; class_idx < pool->nb_classes; class_idx++)
+    {
+        msg_pool_class_t* cls = pool->classes[class_idx];
+        if (cls->block_size < size)
+        {
+            continue;
+        }
+
+        void* block = msg_pool_class_take(pool, cls);
+        if (block != NULL)
+        {
+            cls->stats.spill_count += spilled;
+            return block;
+        }
+
+        if (!spilled)
+        {
+            cls->stats.fail_count++;
+            spilled = true;
+        }
+    }
+
+    pool->drop_count++;
+    return NULL;
+}
+
+void msg_pool_free(msg_pool_t* pool, void* block)
+{
+    if (block == NULL)
+    {
+        return;
+    }
+
+    for (uint8_t class_idx = 0; class_idx < pool->nb_classes; class_idx++)
+    {
+        msg_pool_class_t* cls = pool->classes[class_idx];
+
+        uint32_t offset = (uint8_t*)block - cls->storage;
+        if (((uint8_t*)block < cls->storage)
+            || (offset >= (uint32_t)cls->nb_blocks * cls->block_size))
+        {
+            continue;
+        }
+
+        uint16_t            block_idx   = offset / cls->block_size;
+        msg_pool_block_t*   state       = &(cls->blocks[block_idx]);
+
+        if ((offset % cls->block_size != 0)
+            || (state->next != MSG_POOL_USED))
+        {
+            #ifdef DEBUG
+            NRF_LOG_INFO("Block %p is not allocated!", block);
+            #endif /* DEBUG */
+            return;
+        }
+
+        cls->stats.free_count++;
+        cls->stats.lifetime_sum += pool->clock() - state->alloc_time;
+        cls->stats.used_count--;
+
+        state->next         = cls->free_head;
+        cls->free_head      = block_idx;
+        return;
+    }
+
+    #ifdef DEBUG
+    NRF_LOG_INFO("Block %p is not from this pool!", block);
+    #endif /* DEBUG */
+}
+
+uint32_t msg_pool_lifetime_avg(const msg_pool_class_t* cls)
+{
+    if (cls->stats.free_count == 0)
+    {
+        return 0;
+    }
+
+    return cls->stats.lifetime_sum / cls->stats.free_count;
+}
+
+void msg_pool_stats_reset(msg_pool_t* pool)
+{
+    for (uint8_t class_idx = 0; class_idx < pool->nb_classes; class_idx++)
+    {
+        msg_pool_class_stats_t* stats       = &(pool->classes[class_idx]
+                                                ->stats);
+        uint16_t                used_count  = stats->used_count;
+
+        memset(stats, 0, sizeof(msg_pool_class_stats_t));
+        stats->used_count   = used_count;
+        stats->high_water   = used_count;
+    }
+
+    pool->drop_count = 0;
+}
+
+static void* msg_pool_class_take(msg_pool_t* pool, msg_pool_class_t* cls)
+{
+    uint16_t block_idx = cls->free_head;
+    if (block_idx == MSG_POOL_END)
+    {
+        return NULL;
+    }
+
+    msg_pool_block_t* state = &(cls->blocks[block_idx]);
+
+    cls->free_head      = state->next;
+    state->next         = MSG_POOL_USED;
+    state->alloc_time   = pool->clock();
+
+    cls->stats.alloc_count++;
+    cls->stats.used_count++;
+    if (cls->stats.used_count > cls->stats.high_water)
+    {
+        cls->stats.high_water = cls->stats.used_count;
+    }
+
+    return cls->storage + (uint32_t)block_idx * cls->block_size;
+}
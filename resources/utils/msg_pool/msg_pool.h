@@ -0,0 +1,153 @@
+#ifndef MSG_POOL_H
+#define MSG_POOL_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdint.h>     // uint*_t
+
+/*      DEFINES                                                     */
+
+/* A message pool serves message buffers from a few size classes, each
+** one an array of fixed-size blocks chained in a free list: allocating
+** and freeing are O(1), and the pool never fragments.
+**
+** A message is taken from the smallest class fitting its size. If that
+** class is exhausted, the failure is counted for it and the message
+** spills to the next larger classes. The message is dropped if none of
+** them has a free block.
+**
+** The pool is not reentrant: all the functions shall be called from the
+** same context.
+*/
+
+// Alignment of the blocks.
+#define MSG_POOL_ALIGN          4
+
+// Size of a block holding messages of up to the given size.
+#define MSG_POOL_BLOCK_SIZE(_size)  \
+    (((_size) + MSG_POOL_ALIGN - 1) & ~(MSG_POOL_ALIGN - 1))
+
+/* Defines a size class instance of `_nb_blocks` blocks, holding messages
+** of up to `_size` bytes, and its storage.
+*/
+#define MSG_POOL_CLASS_DEF(_name, _size, _nb_blocks)                    \
+    static uint32_t _name ## _storage[(_nb_blocks)                      \
+                                      * MSG_POOL_BLOCK_SIZE(_size)      \
+                                      / sizeof(uint32_t)];              \
+    static msg_pool_block_t _name ## _blocks[_nb_blocks];              \
+    static msg_pool_class_t _name =                                     \
+    {                                                                   \
+        .storage    = (uint8_t*)(_name ## _storage),                    \
+        .blocks     = _name ## _blocks,                                 \
+        .block_size = MSG_POOL_BLOCK_SIZE(_size),                       \
+        .nb_blocks  = (_nb_blocks),                                     \
+    }/*;*/
+
+/* Defines a message pool instance timed by the given clock. Classes are
+** given as `&class` pointers, by increasing size.
+*/
+#define MSG_POOL_DEF(_name, _clock, ...)                                \
+    static msg_pool_class_t* _name ## _classes[] = { __VA_ARGS__ };     \
+    static msg_pool_t _name =                                           \
+    {                                                                   \
+        .classes    = _name ## _classes,                                \
+        .nb_classes = sizeof(_name ## _classes)                         \
+                      / sizeof(_name ## _classes[0]),                   \
+        .clock      = (_clock),                                         \
+    }/*;*/
+
+/* Returns the current time of a pool, in any unit, from a free-running
+** 32-bit counter.
+*/
+typedef uint32_t(*msg_pool_clock_t)(void);
+
+// Statistics of a size class.
+typedef struct
+{
+    // Number of blocks given.
+    uint32_t    alloc_count;
+
+    // Number of messages of the class size it could not hold.
+    uint32_t    fail_count;
+
+    // Number of messages of smaller classes it held.
+    uint32_t    spill_count;
+
+    // Number of blocks currently used, and its maximum.
+    uint16_t    used_count;
+    uint16_t    high_water;
+
+    // Number of blocks freed, and sum of their lifetimes.
+    uint32_t    free_count;
+    uint32_t    lifetime_sum;
+} msg_pool_class_stats_t;
+
+// State of a block.
+typedef struct
+{
+    // Next free block, or MSG_POOL_USED if the block is used.
+    uint16_t    next;
+
+    // Time of the allocation of the block.
+    uint32_t    alloc_time;
+} msg_pool_block_t;
+
+// Size class instance.
+typedef struct
+{
+    // Blocks, one after the other.
+    uint8_t*                storage;
+
+    // State of the blocks.
+    msg_pool_block_t*       blocks;
+
+    // Size of a block in bytes.
+    uint16_t                block_size;
+
+    // Number of blocks.
+    uint16_t                nb_blocks;
+
+    // First free block, or MSG_POOL_END if there is none.
+    uint16_t                free_head;
+
+    // Statistics.
+    msg_pool_class_stats_t  stats;
+} msg_pool_class_t;
+
+// Message pool instance.
+typedef struct
+{
+    // Size classes, by increasing size.
+    msg_pool_class_t**  classes;
+
+    // Number of size classes.
+    uint8_t             nb_classes;
+
+    // Clock measuring the lifetimes.
+    msg_pool_clock_t    clock;
+
+    // Number of dropped messages.
+    uint32_t            drop_count;
+} msg_pool_t;
+
+// Initializes the given pool instance, with every block free.
+void msg_pool_init(msg_pool_t* pool);
+
+/* Returns a block of the given pool able to hold `size` bytes, or NULL
+** if the message is dropped.
+*/
+void* msg_pool_alloc(msg_pool_t* pool, uint16_t size);
+
+// Gives the given block back to the given pool.
+void msg_pool_free(msg_pool_t* pool, void* block);
+
+/* Returns the average lifetime of the blocks of the given class, in the
+** unit of the pool clock.
+*/
+uint32_t msg_pool_lifetime_avg(const msg_pool_class_t* cls);
+
+// Resets the statistics of the given pool, except the used blocks counts.
+void msg_pool_stats_reset(msg_pool_t* pool);
+
+#endif /* ! MSG_POOL_H */
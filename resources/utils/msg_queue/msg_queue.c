@@ -3,67 +3,478 @@
 /*      INCLUDES                                                    */
 
 // C STANDARD
+#include <stdatomic.h>  // atomic_*, memory_order_*
+#include <stdbool.h>    // bool
+#include <stddef.h>     // NULL
 #include <stdint.h>     // uint*_t
 #include <string.h>     // memcpy
 
-// NRF
-#include "ble_nus.h"    // BLE_NUS_MAX_DATA_LEN
-
 #ifdef DEBUG
 #include "nrf_log.h"    // NRF_LOG_INFO
 #endif /* DEBUG */
 
 /*      STATIC VARIABLES & CONSTANTS                                */
 
-// Number of buffers.
-#define NB_TX_BUFFERS   8
+/* Length prefix marking the end of the used part of the ring: the next
+** message is stored at its beginning.
+*/
+#define WRAP_MARKER     UINT16_MAX
+
+// Default queue.
+MSG_QUEUE_DEF(s_default_queue, MSG_QUEUE_DEFAULT_DEPTH, TX_BUF_SIZE);
+
+msg_queue_t* const msg_queue_default = &s_default_queue;
+
+// Control queue.
+MSG_QUEUE_DEF(s_control_queue, MSG_QUEUE_CONTROL_DEPTH, TX_BUF_SIZE);
+
+msg_queue_t* const msg_queue_control = &s_control_queue;
+
+// Lanes of the singleton functions, in msg_queue_lane_idx_t order.
+MSG_QUEUE_LANES_DEF(s_default_lanes, MSG_QUEUE_LANES_STRICT,
+                    { &s_control_queue, 1 }, { &s_default_queue, 1 });
+
+// Lane selection function of `msg_queue_enqueue`.
+static msg_queue_lane_select_t s_lane_select = NULL;
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Computes in `offset` where a message of the given size can be stored
+** in the queue, given the current write and read offsets. Returns false
+** if there is not enough room.
+*/
+static bool record_place(const msg_queue_t* queue, uint16_t write_offset,
+                         uint16_t read_offset, uint16_t size,
+                         uint16_t* offset);
+
+/* Writes the length prefix of a message of the given size stored at the
+** given offset, and the wrap marker if the message was wrapped. Returns
+** the write offset following the message.
+*/
+static uint16_t record_write(msg_queue_t* queue, uint16_t write_offset,
+                             uint16_t offset, uint16_t size);
+
+/* Moves the given offset past the wrap marker if there is one. Returns
+** false if the given offset reached the write offset.
+*/
+static bool record_locate(const msg_queue_t* queue, uint16_t write_offset,
+                          uint16_t* offset);
 
-// Buffers table.
-static tx_buffer_t  s_msg_queue[NB_TX_BUFFERS]  = { 0 };
+// Updates the statistics after the given number of messages was enqueued.
+static void stats_update(msg_queue_t* queue, uint16_t nb_committed);
 
-// Current buffer to send.
-static uint16_t     s_current_buffer_idx        = 0;
+// Reads the length prefix located at the given offset of the queue.
+static uint16_t header_read(const msg_queue_t* queue, uint16_t offset);
 
-// Index of next enqueued buffer.
-static uint16_t     s_msg_queue_idx             = 0;
+// Writes the given length prefix at the given offset of the queue.
+static void header_write(msg_queue_t* queue, uint16_t offset,
+                         uint16_t size);
+
+void msg_queue_lane_select_set(msg_queue_lane_select_t select)
+{
+    s_lane_select = select;
+}
 
 bool msg_queue_enqueue(const uint8_t* data, uint16_t size)
 {
-    tx_buffer_t* new_head = s_msg_queue + s_msg_queue_idx;
+    msg_queue_lane_idx_t lane_idx = MSG_QUEUE_LANE_DATA;
+    if (s_lane_select != NULL)
+    {
+        lane_idx = s_lane_select(data, size);
+    }
+
+    return msg_queue_lanes_enqueue(&s_default_lanes, lane_idx, data, size);
+}
+
+tx_buffer_t* msg_queue_peek(void)
+{
+    return msg_queue_lanes_peek(&s_default_lanes);
+}
+
+void msg_queue_pop(void)
+{
+    msg_queue_lanes_pop(&s_default_lanes);
+}
 
-    if (new_head->size != 0)
+uint8_t* msg_queue_inst_reserve(msg_queue_t* queue, uint16_t size)
+{
+    uint16_t write_offset   = atomic_load_explicit(&(queue->write_offset),
+                                                   memory_order_relaxed);
+
+    /* Acquire: the consumer is done with everything before this offset,
+    ** so it can be overwritten.
+    */
+    uint16_t read_offset    = atomic_load_explicit(&(queue->read_offset),
+                                                   memory_order_acquire);
+
+    bool placed = record_place(queue, write_offset, read_offset, size,
+                               &(queue->reserved_offset));
+    if (!placed)
     {
-        // Current insertion buffer is not available.
-        return false;
+        queue->stats.overflow_count++;
+        return NULL;
     }
 
-    memcpy(new_head->buffer, data, size);
-    new_head->size = size;
+    return queue->ring + queue->reserved_offset + MSG_QUEUE_HEADER_SIZE;
+}
+
+void msg_queue_inst_commit(msg_queue_t* queue, uint16_t size)
+{
+    uint16_t write_offset = atomic_load_explicit(&(queue->write_offset),
+                                                 memory_order_relaxed);
+
+    write_offset = record_write(queue, write_offset,
+                                queue->reserved_offset, size);
+
+    // Release: the message is written before being visible.
+    atomic_store_explicit(&(queue->write_offset), write_offset,
+                          memory_order_release);
+
+    stats_update(queue, 1);
+}
+
+bool msg_queue_inst_enqueue(msg_queue_t* queue, const uint8_t* data,
+                            uint16_t size)
+{
+    uint8_t* new_head = msg_queue_inst_reserve(queue, size);
+    if (new_head == NULL)
+    {
+        // Queue is full.
+        return false;
+    }
 
-    s_msg_queue_idx++;
-    s_msg_queue_idx %= NB_TX_BUFFERS;
+    memcpy(new_head, data, size);
+    msg_queue_inst_commit(queue, size);
 
     return true;
 }
 
-tx_buffer_t* msg_queue_peek(void)
+uint16_t msg_queue_inst_enqueue_n(msg_queue_t* queue,
+                                  const tx_buffer_t* buffers, uint16_t count)
 {
-    tx_buffer_t* tail = s_msg_queue + s_current_buffer_idx;
+    uint16_t write_offset   = atomic_load_explicit(&(queue->write_offset),
+                                                   memory_order_relaxed);
+    uint16_t read_offset    = atomic_load_explicit(&(queue->read_offset),
+                                                   memory_order_acquire);
 
-    if (tail->size == 0)
+    uint16_t nb_enqueued = 0;
+    while (nb_enqueued < count)
     {
-        // Buffer is not in use: queue is empty.
+        const tx_buffer_t* buffer = buffers + nb_enqueued;
+
+        uint16_t offset;
+        bool placed = record_place(queue, write_offset, read_offset,
+                                   buffer->size, &offset);
+        if (!placed)
+        {
+            // Queue is full.
+            break;
+        }
+
+        memcpy(queue->ring + offset + MSG_QUEUE_HEADER_SIZE,
+               buffer->buffer, buffer->size);
+        write_offset = record_write(queue, write_offset, offset,
+                                    buffer->size);
+
+        nb_enqueued++;
+    }
+
+    if (nb_enqueued > 0)
+    {
+        // Release: all the messages are written before being visible.
+        atomic_store_explicit(&(queue->write_offset), write_offset,
+                              memory_order_release);
+
+        stats_update(queue, nb_enqueued);
+    }
+
+    queue->stats.overflow_count += count - nb_enqueued;
+
+    return nb_enqueued;
+}
+
+tx_buffer_t* msg_queue_inst_peek(msg_queue_t* queue)
+{
+    uint16_t nb_peeked = msg_queue_inst_peek_n(queue, &(queue->peeked_buffer),
+                                               1);
+    if (nb_peeked == 0)
+    {
+        // Queue is empty.
         return NULL;
     }
 
-    return tail;
+    return &(queue->peeked_buffer);
 }
 
-void msg_queue_pop(void)
+uint16_t msg_queue_inst_peek_n(msg_queue_t* queue, tx_buffer_t* buffers,
+                               uint16_t max_count)
+{
+    uint16_t read_offset    = atomic_load_explicit(&(queue->read_offset),
+                                                   memory_order_relaxed);
+
+    // Acquire: messages before this offset are fully written.
+    uint16_t write_offset   = atomic_load_explicit(&(queue->write_offset),
+                                                   memory_order_acquire);
+
+    uint16_t nb_peeked = 0;
+    while (nb_peeked < max_count
+           && record_locate(queue, write_offset, &read_offset))
+    {
+        uint16_t size = header_read(queue, read_offset);
+
+        buffers[nb_peeked].buffer   = queue->ring + read_offset
+                                      + MSG_QUEUE_HEADER_SIZE;
+        buffers[nb_peeked].size     = size;
+
+        read_offset += MSG_QUEUE_RECORD_SIZE(size);
+        if (read_offset == queue->ring_size)
+        {
+            read_offset = 0;
+        }
+
+        nb_peeked++;
+    }
+
+    return nb_peeked;
+}
+
+void msg_queue_inst_pop(msg_queue_t* queue)
+{
+    msg_queue_inst_pop_n(queue, 1);
+}
+
+void msg_queue_inst_pop_n(msg_queue_t* queue, uint16_t count)
+{
+    uint16_t read_offset    = atomic_load_explicit(&(queue->read_offset),
+                                                   memory_order_relaxed);
+    uint16_t write_offset   = atomic_load_explicit(&(queue->write_offset),
+                                                   memory_order_acquire);
+
+    uint16_t nb_popped = 0;
+    while (nb_popped < count
+           && record_locate(queue, write_offset, &read_offset))
+    {
+        read_offset += MSG_QUEUE_RECORD_SIZE(header_read(queue,
+                                                         read_offset));
+        if (read_offset == queue->ring_size)
+        {
+            read_offset = 0;
+        }
+
+        nb_popped++;
+    }
+
+    if (nb_popped == 0)
+    {
+        // Nothing to pop.
+        return;
+    }
+
+    // Release: the messages are not accessed anymore once popped.
+    atomic_store_explicit(&(queue->read_offset), read_offset,
+                          memory_order_release);
+
+    nb_popped += atomic_load_explicit(&(queue->nb_popped),
+                                      memory_order_relaxed);
+    atomic_store_explicit(&(queue->nb_popped), nb_popped,
+                          memory_order_relaxed);
+}
+
+uint16_t msg_queue_inst_count(const msg_queue_t* queue)
+{
+    uint16_t nb_popped      = atomic_load_explicit(&(queue->nb_popped),
+                                                   memory_order_relaxed);
+    uint16_t nb_committed   = atomic_load_explicit(&(queue->nb_committed),
+                                                   memory_order_relaxed);
+
+    // Wrapping counters: the difference is the number of held messages.
+    return nb_committed - nb_popped;
+}
+
+bool msg_queue_lanes_enqueue(msg_queue_lanes_t* lanes, uint8_t lane_idx,
+                             const uint8_t* data, uint16_t size)
+{
+    if (lane_idx >= lanes->nb_lanes)
+    {
+        #ifdef DEBUG
+        NRF_LOG_INFO("Lane %u does not exist!", lane_idx);
+        #endif /* DEBUG */
+
+        return false;
+    }
+
+    return msg_queue_inst_enqueue(lanes->lanes[lane_idx].queue, data, size);
+}
+
+tx_buffer_t* msg_queue_lanes_peek(msg_queue_lanes_t* lanes)
+{
+    if (lanes->policy == MSG_QUEUE_LANES_STRICT)
+    {
+        for (uint8_t lane_idx = 0; lane_idx < lanes->nb_lanes; lane_idx++)
+        {
+            msg_queue_t* queue = lanes->lanes[lane_idx].queue;
+
+            tx_buffer_t* tail = msg_queue_inst_peek(queue);
+            if (tail != NULL)
+            {
+                lanes->peeked_lane = lane_idx;
+                return tail;
+            }
+        }
+
+        return NULL;
+    }
+
+    // Each lane is visited once, the current one twice if out of credits.
+    for (uint8_t visit = 0; visit <= lanes->nb_lanes; visit++)
+    {
+        if (lanes->credits > 0)
+        {
+            msg_queue_t* queue = lanes->lanes[lanes->current_lane].queue;
+
+            tx_buffer_t* tail = msg_queue_inst_peek(queue);
+            if (tail != NULL)
+            {
+                lanes->peeked_lane = lanes->current_lane;
+                return tail;
+            }
+        }
+
+        // Lane is empty or out of credits: serve the next one.
+        lanes->current_lane++;
+        if (lanes->current_lane == lanes->nb_lanes)
+        {
+            lanes->current_lane = 0;
+        }
+
+        lanes->credits = lanes->lanes[lanes->current_lane].weight;
+    }
+
+    return NULL;
+}
+
+void msg_queue_lanes_pop(msg_queue_lanes_t* lanes)
+{
+    msg_queue_inst_pop(lanes->lanes[lanes->peeked_lane].queue);
+
+    if (lanes->peeked_lane == lanes->current_lane && lanes->credits > 0)
+    {
+        lanes->credits--;
+    }
+}
+
+static bool record_place(const msg_queue_t* queue, uint16_t write_offset,
+                         uint16_t read_offset, uint16_t size,
+                         uint16_t* offset)
+{
+    if (size > queue->slot_size)
+    {
+        #ifdef DEBUG
+        NRF_LOG_INFO("Message too big for the queue!");
+        #endif /* DEBUG */
+
+        return false;
+    }
+
+    uint16_t record_size = MSG_QUEUE_RECORD_SIZE(size);
+
+    /* The write offset must never catch up with the read offset, since
+    ** equal offsets mean the queue is empty.
+    */
+    if (write_offset < read_offset)
+    {
+        if (write_offset + record_size >= read_offset)
+        {
+            // Not enough room before the next message to send.
+            return false;
+        }
+
+        *offset = write_offset;
+    }
+    else if (write_offset + record_size < queue->ring_size
+             || (write_offset + record_size == queue->ring_size
+                 && read_offset != 0))
+    {
+        *offset = write_offset;
+    }
+    else if (record_size < read_offset)
+    {
+        // Not enough room at the end: wrap to the beginning.
+        *offset = 0;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+static uint16_t record_write(msg_queue_t* queue, uint16_t write_offset,
+                             uint16_t offset, uint16_t size)
+{
+    if (offset != write_offset)
+    {
+        // Message was wrapped: mark the end of the used part.
+        header_write(queue, write_offset, WRAP_MARKER);
+    }
+
+    header_write(queue, offset, size);
+
+    write_offset = offset + MSG_QUEUE_RECORD_SIZE(size);
+    if (write_offset == queue->ring_size)
+    {
+        write_offset = 0;
+    }
+
+    return write_offset;
+}
+
+static bool record_locate(const msg_queue_t* queue, uint16_t write_offset,
+                          uint16_t* offset)
 {
-    // Buffer is not used anymore.
-    s_msg_queue[s_current_buffer_idx].size = 0;
+    if (*offset == write_offset)
+    {
+        // No more message.
+        return false;
+    }
 
-    s_current_buffer_idx++;
-    s_current_buffer_idx %= NB_TX_BUFFERS;
+    if (header_read(queue, *offset) == WRAP_MARKER)
+    {
+        // Next message is at the beginning of the ring.
+        *offset = 0;
+    }
+
+    return (*offset != write_offset);
+}
+
+static void stats_update(msg_queue_t* queue, uint16_t nb_committed)
+{
+    nb_committed += atomic_load_explicit(&(queue->nb_committed),
+                                         memory_order_relaxed);
+    atomic_store_explicit(&(queue->nb_committed), nb_committed,
+                          memory_order_relaxed);
+
+    // Wrapping counters: the difference is the number of held messages.
+    uint16_t nb_popped  = atomic_load_explicit(&(queue->nb_popped),
+                                               memory_order_relaxed);
+    uint16_t nb_held    = nb_committed - nb_popped;
+    if (nb_held > queue->stats.high_water_mark)
+    {
+        queue->stats.high_water_mark = nb_held;
+    }
+}
+
+static uint16_t header_read(const msg_queue_t* queue, uint16_t offset)
+{
+    uint16_t size;
+    memcpy(&size, queue->ring + offset, MSG_QUEUE_HEADER_SIZE);
+
+    return size;
+}
+
+static void header_write(msg_queue_t* queue, uint16_t offset,
+                         uint16_t size)
+{
+    memcpy(queue->ring + offset, &size, MSG_QUEUE_HEADER_SIZE);
 }
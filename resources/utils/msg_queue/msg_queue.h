@@ -4,6 +4,8 @@
 /*      INCLUDES                                                    */
 
 // C STANDARD
+#include <stdatomic.h>  // _Atomic
+#include <stdbool.h>    // bool
 #include <stdint.h>     // uint*_t
 
 // NRF
@@ -11,29 +13,297 @@
 
 /*      DEFINES                                                     */
 
-// TX buffer max size
-#define TX_BUF_SIZE     BLE_NUS_MAX_DATA_LEN - 1
+/* Each queue is a lock-free single-producer/single-consumer ring:
+** -    The reserve, commit and enqueue functions shall only be called
+**      from one context (the producer).
+** -    The peek and pop functions shall only be called from one context
+**      (the consumer).
+** Both contexts may run at different interrupt priorities and preempt
+** each other: no critical section is needed.
+*/
+
+/* TX buffer max size, for the largest MTU the stack can negotiate.
+** Messages are stored at their own size: a smaller negotiated MTU
+** leaves room for more of them rather than wasting slots.
+*/
+#define TX_BUF_SIZE     (BLE_NUS_MAX_DATA_LEN - 1)
+
+// Size of the length prefix stored before each message in the queue.
+#define MSG_QUEUE_HEADER_SIZE           sizeof(uint16_t)
+
+/* Size occupied in the queue by a message of the given size: length
+** prefix included, rounded up so that every prefix stays aligned.
+*/
+#define MSG_QUEUE_RECORD_SIZE(_size)    \
+    ((MSG_QUEUE_HEADER_SIZE + (_size) + 1) & ~1)
+
+/* Size in bytes of the storage of a queue able to hold `_depth`
+** messages of `_slot_size` bytes. One more record is reserved for the
+** space lost when wrapping and the gap between write and read offsets.
+*/
+#define MSG_QUEUE_RING_SIZE(_depth, _slot_size)     \
+    (((_depth) + 1) * MSG_QUEUE_RECORD_SIZE(_slot_size))
+
+/* Defines a message queue instance able to hold `_depth` messages of
+** `_slot_size` bytes, and its storage.
+*/
+#define MSG_QUEUE_DEF(_name, _depth, _slot_size)                        \
+    static uint8_t _name ## _ring[MSG_QUEUE_RING_SIZE(_depth,           \
+                                                      _slot_size)];     \
+    static msg_queue_t _name =                                          \
+    {                                                                   \
+        .ring       = _name ## _ring,                                   \
+        .ring_size  = MSG_QUEUE_RING_SIZE(_depth, _slot_size),          \
+        .slot_size  = (_slot_size),                                     \
+    }/*;*/
+
+/* Defines a multi-lane queue instance scheduled with the given policy.
+** Lanes are given as `{ &queue, weight }` initializers, by decreasing
+** priority.
+*/
+#define MSG_QUEUE_LANES_DEF(_name, _policy, ...)                        \
+    static msg_queue_lane_t _name ## _lanes[] = { __VA_ARGS__ };        \
+    static msg_queue_lanes_t _name =                                    \
+    {                                                                   \
+        .lanes          = _name ## _lanes,                              \
+        .nb_lanes       = MSG_QUEUE_NB_LANES(_name ## _lanes),          \
+        .policy         = (_policy),                                    \
+        .current_lane   = MSG_QUEUE_NB_LANES(_name ## _lanes) - 1,      \
+    }/*;*/
+
+/* Depth of the default queue: the depth of the single queue the module
+** used to provide.
+*/
+#define MSG_QUEUE_DEFAULT_DEPTH         8
+
+/* Depth of the control queue, served before the default one by
+** `msg_queue_peek`.
+*/
+#define MSG_QUEUE_CONTROL_DEPTH         4
+
+// Number of lanes in the given lanes array.
+#define MSG_QUEUE_NB_LANES(_lanes)  (sizeof(_lanes) / sizeof((_lanes)[0]))
 
-// TX buffer and size.
+// View on a message stored in a queue.
 typedef struct
 {
-    // Data to send.
-    uint8_t     buffer[TX_BUF_SIZE];
+    // Data to send, located in the queue memory.
+    uint8_t*    buffer;
 
     // Size in bytes.
     uint16_t    size;
 
 } tx_buffer_t;
 
-/* Enqueues the given message. Returns true if the operation could be
+// Usage statistics of a queue, for sizing purposes.
+typedef struct
+{
+    // Maximum number of messages simultaneously held in the queue.
+    uint16_t    high_water_mark;
+
+    // Number of messages which could not be enqueued.
+    uint32_t    overflow_count;
+
+} msg_queue_stats_t;
+
+// Message queue instance.
+typedef struct
+{
+    // Messages storage: length-prefixed records.
+    uint8_t*            ring;
+
+    // Size of the storage in bytes.
+    uint16_t            ring_size;
+
+    // Maximum size of a message in bytes.
+    uint16_t            slot_size;
+
+    // Offset of the next message to send, written by the consumer.
+    _Atomic uint16_t    read_offset;
+
+    // Offset of the next enqueued message, written by the producer.
+    _Atomic uint16_t    write_offset;
+
+    // Offset of the last reserved area, length prefix included.
+    uint16_t            reserved_offset;
+
+    // Number of committed messages, written by the producer.
+    _Atomic uint16_t    nb_committed;
+
+    // Number of popped messages, written by the consumer.
+    _Atomic uint16_t    nb_popped;
+
+    // View on the last message, returned by `msg_queue_inst_peek`.
+    tx_buffer_t         peeked_buffer;
+
+    // Usage statistics, written by the producer.
+    msg_queue_stats_t   stats;
+
+} msg_queue_t;
+
+// Scheduling policy between the lanes of a multi-lane queue.
+typedef enum
+{
+    /* A lane is only served when all the lanes with a higher priority
+    ** are empty.
+    */
+    MSG_QUEUE_LANES_STRICT,
+
+    /* Lanes are served in turn, each one for at most as many messages as
+    ** its weight.
+    */
+    MSG_QUEUE_LANES_WEIGHTED,
+
+} msg_queue_lanes_policy_t;
+
+// Lane of a multi-lane queue.
+typedef struct
+{
+    // Queue storing the messages of the lane.
+    msg_queue_t*    queue;
+
+    // Number of messages served in a row, for the weighted policy.
+    uint8_t         weight;
+
+} msg_queue_lane_t;
+
+/* Multi-lane queue instance. Each lane may have its own producer, but
+** all lanes shall share the same consumer.
+*/
+typedef struct
+{
+    // Lanes, by decreasing priority.
+    msg_queue_lane_t*           lanes;
+
+    // Number of lanes.
+    uint8_t                     nb_lanes;
+
+    // Scheduling policy between the lanes.
+    msg_queue_lanes_policy_t    policy;
+
+    /* Lane currently served, for the weighted policy. Starts on the last
+    ** lane, so that the first peek moves to the first one.
+    */
+    uint8_t                     current_lane;
+
+    // Messages left to serve from the current lane.
+    uint8_t                     credits;
+
+    // Lane of the message returned by the last peek.
+    uint8_t                     peeked_lane;
+
+} msg_queue_lanes_t;
+
+// Lanes behind `msg_queue_enqueue`, by decreasing priority.
+typedef enum
+{
+    // Control messages, sent as soon as the link allows.
+    MSG_QUEUE_LANE_CONTROL,
+
+    // Other messages, stored in the default queue.
+    MSG_QUEUE_LANE_DATA,
+
+} msg_queue_lane_idx_t;
+
+/* Function returning the lane in which `msg_queue_enqueue` stores the
+** given message.
+*/
+typedef msg_queue_lane_idx_t (*msg_queue_lane_select_t)(const uint8_t* data,
+                                                        uint16_t size);
+
+/* Default queue, holding MSG_QUEUE_DEFAULT_DEPTH messages of TX_BUF_SIZE
+** bytes: the single queue the module used to provide, still used by
+** `msg_queue_enqueue`, `msg_queue_peek` and `msg_queue_pop`. With the
+** control queue, it forms the strict lanes of these functions.
+*/
+extern msg_queue_t* const msg_queue_default;
+
+// Control queue, holding MSG_QUEUE_CONTROL_DEPTH messages of TX_BUF_SIZE.
+extern msg_queue_t* const msg_queue_control;
+
+/* Sets the function choosing the lane of each message enqueued by
+** `msg_queue_enqueue`. Without one, every message goes to the default
+** queue. Can be called before the sending starts, by a module not
+** owning the queues.
+*/
+void msg_queue_lane_select_set(msg_queue_lane_select_t select);
+
+/* Enqueues the given message in the control or default queue, as chosen
+** by the lane selection function. Returns true if the operation could be
 ** performed, false otherwise.
 */
 bool msg_queue_enqueue(const uint8_t* data, uint16_t size);
 
-// Returns the last TX buffer in the queue, or NULL if it is empty.
+/* Returns the last TX buffer in the control queue, or else in the
+** default queue, or NULL if both are empty.
+*/
 tx_buffer_t* msg_queue_peek(void);
 
-// Pops the last TX buffer from the queue.
+// Pops the TX buffer returned by the last `msg_queue_peek`.
 void msg_queue_pop(void);
 
+/* Reserves a contiguous area of the given size in the given queue and
+** returns its address, or NULL if there is not enough room. The area is
+** only made visible to the consumer by `msg_queue_inst_commit`.
+*/
+uint8_t* msg_queue_inst_reserve(msg_queue_t* queue, uint16_t size);
+
+/* Publishes the last area reserved in the given queue, whose first
+** `size` bytes were written. The size must not exceed the reserved one.
+*/
+void msg_queue_inst_commit(msg_queue_t* queue, uint16_t size);
+
+/* Enqueues the given message in the given queue. Returns true if the
+** operation could be performed, false otherwise.
+*/
+bool msg_queue_inst_enqueue(msg_queue_t* queue, const uint8_t* data,
+                            uint16_t size);
+
+/* Enqueues the given messages in the given queue, and makes them
+** visible to the consumer at once. Stops at the first message which
+** does not fit, and returns the number of enqueued messages.
+*/
+uint16_t msg_queue_inst_enqueue_n(msg_queue_t* queue,
+                                  const tx_buffer_t* buffers,
+                                  uint16_t count);
+
+/* Returns a view on the last message in the given queue, or NULL if it
+** is empty. The view is valid until the next call to
+** `msg_queue_inst_pop`.
+*/
+tx_buffer_t* msg_queue_inst_peek(msg_queue_t* queue);
+
+/* Fills the given array with views on the at most `max_count` last
+** messages in the given queue, oldest first. Returns the number of
+** filled views, which are valid until they are popped.
+*/
+uint16_t msg_queue_inst_peek_n(msg_queue_t* queue, tx_buffer_t* buffers,
+                               uint16_t max_count);
+
+/* Returns the number of messages currently held in the given queue. Can
+** be called from any context, as an estimate of the backlog.
+*/
+uint16_t msg_queue_inst_count(const msg_queue_t* queue);
+
+// Pops the last message from the given queue.
+void msg_queue_inst_pop(msg_queue_t* queue);
+
+// Pops the `count` last messages from the given queue.
+void msg_queue_inst_pop_n(msg_queue_t* queue, uint16_t count);
+
+/* Enqueues the given message in the given lane of the given multi-lane
+** queue. Returns true if the operation could be performed, false
+** otherwise.
+*/
+bool msg_queue_lanes_enqueue(msg_queue_lanes_t* lanes, uint8_t lane_idx,
+                             const uint8_t* data, uint16_t size);
+
+/* Returns a view on the next message to send according to the policy of
+** the given multi-lane queue, or NULL if all its lanes are empty.
+*/
+tx_buffer_t* msg_queue_lanes_peek(msg_queue_lanes_t* lanes);
+
+// Pops the message returned by the last peek on the given queue.
+void msg_queue_lanes_pop(msg_queue_lanes_t* lanes);
+
 #endif /* ! MSG_QUEUE_H */
@@ -0,0 +1,177 @@
+#include "route_table.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stddef.h>     // NULL
+#include <string.h>     // memset, strncmp, strncpy
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// FNV-1a parameters, for the alias hash.
+#define ROUTE_TABLE_HASH_INIT   0x811C9DC5
+#define ROUTE_TABLE_HASH_PRIME  0x01000193
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Returns the index of the alias hash table slot holding the given
+** alias in the given routing table, or of the empty slot where it would
+** be inserted.
+*/
+static uint16_t route_table_alias_slot(const route_table_t* table,
+                                       const char* alias);
+
+/* Returns the index of the entry of the given ID in the given routing
+** table, or ROUTE_TABLE_INVALID_IDX if there is none.
+*/
+static uint16_t route_table_id_idx(const route_table_t* table, uint16_t id);
+
+void route_table_clear(route_table_t* table)
+{
+    table->nb_entries = 0;
+
+    memset(table->by_id, 0xFF, (table->max_entries + 1) * sizeof(uint16_t));
+    memset(table->by_alias, 0xFF, table->nb_slots * sizeof(uint16_t));
+    memset(table->type_heads, 0xFF, sizeof(table->type_heads));
+    memset(table->type_tails, 0xFF, sizeof(table->type_tails));
+}
+
+bool route_table_add(route_table_t* table, uint16_t id, uint16_t node_id,
+                     uint8_t type, const char* alias)
+{
+    if ((table->nb_entries >= table->max_entries)
+        || (id == ROUTE_TABLE_INVALID_ID)
+        || (route_table_id_idx(table, id) != ROUTE_TABLE_INVALID_IDX))
+    {
+        return false;
+    }
+
+    uint16_t slot = route_table_alias_slot(table, alias);
+    if (table->by_alias[slot] != ROUTE_TABLE_INVALID_IDX)
+    {
+        return false;
+    }
+
+    uint16_t                entry_idx   = table->nb_entries++;
+    route_table_entry_t*    entry       = &(table->entries[entry_idx]);
+
+    memset(entry, 0, sizeof(route_table_entry_t));
+    entry->id           = id;
+    entry->node_id      = node_id;
+    entry->type         = type;
+    entry->next_of_type = ROUTE_TABLE_INVALID_IDX;
+    strncpy(entry->alias, alias, ROUTE_TABLE_ALIAS_SIZE - 1);
+
+    if (id <= table->max_entries)
+    {
+        table->by_id[id] = entry_idx;
+    }
+
+    table->by_alias[slot] = entry_idx;
+
+    if (table->type_tails[type] == ROUTE_TABLE_INVALID_IDX)
+    {
+        table->type_heads[type] = entry_idx;
+    }
+    else
+    {
+        table->entries[table->type_tails[type]].next_of_type = entry_idx;
+    }
+    table->type_tails[type] = entry_idx;
+
+    return true;
+}
+
+const route_table_entry_t* route_table_from_id(const route_table_t* table,
+                                               uint16_t id)
+{
+    uint16_t entry_idx = route_table_id_idx(table, id);
+
+    return (entry_idx != ROUTE_TABLE_INVALID_IDX)
+           ? &(table->entries[entry_idx]) : NULL;
+}
+
+uint16_t route_table_id_from_alias(const route_table_t* table,
+                                   const char* alias)
+{
+    uint16_t entry_idx = table->by_alias[route_table_alias_slot(table,
+                                                                alias)];
+
+    return (entry_idx != ROUTE_TABLE_INVALID_IDX)
+           ? table->entries[entry_idx].id : ROUTE_TABLE_INVALID_ID;
+}
+
+uint16_t route_table_node_from_id(const route_table_t* table, uint16_t id)
+{
+    const route_table_entry_t* entry = route_table_from_id(table, id);
+
+    return (entry != NULL) ? entry->node_id : ROUTE_TABLE_INVALID_ID;
+}
+
+const route_table_entry_t* route_table_type_first(
+    const route_table_t* table, uint8_t type)
+{
+    uint16_t entry_idx = table->type_heads[type];
+
+    return (entry_idx != ROUTE_TABLE_INVALID_IDX)
+           ? &(table->entries[entry_idx]) : NULL;
+}
+
+const route_table_entry_t* route_table_type_next(
+    const route_table_t* table, const route_table_entry_t* entry)
+{
+    uint16_t entry_idx = entry->next_of_type;
+
+    return (entry_idx != ROUTE_TABLE_INVALID_IDX)
+           ? &(table->entries[entry_idx]) : NULL;
+}
+
+static uint16_t route_table_alias_slot(const route_table_t* table,
+                                       const char* alias)
+{
+    uint32_t hash = ROUTE_TABLE_HASH_INIT;
+
+    for (uint8_t char_idx = 0;
+         (char_idx < ROUTE_TABLE_ALIAS_SIZE - 1) && (alias[char_idx] != '\0');
+         char_idx++)
+    {
+        hash ^= (uint8_t)alias[char_idx];
+        hash *= ROUTE_TABLE_HASH_PRIME;
+    }
+
+    // Linear probing: the table is never more than half full.
+    uint16_t slot = hash & (table->nb_slots - 1);
+
+    while (table->by_alias[slot] != ROUTE_TABLE_INVALID_IDX)
+    {
+        const char* slot_alias = table->entries[table->by_alias[slot]].alias;
+
+        if (strncmp(slot_alias, alias, ROUTE_TABLE_ALIAS_SIZE - 1) == 0)
+        {
+            break;
+        }
+
+        slot = (slot + 1) & (table->nb_slots - 1);
+    }
+
+    return slot;
+}
+
+static uint16_t route_table_id_idx(const route_table_t* table, uint16_t id)
+{
+    if (id <= table->max_entries)
+    {
+        return table->by_id[id];
+    }
+
+    // IDs beyond the direct array are only found by a scan.
+    for (uint16_t entry_idx = 0; entry_idx < table->nb_entries; entry_idx++)
+    {
+        if (table->entries[entry_idx].id == id)
+        {
+            return entry_idx;
+        }
+    }
+
+    return ROUTE_TABLE_INVALID_IDX;
+}
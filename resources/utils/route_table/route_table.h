@@ -0,0 +1,137 @@
+#ifndef ROUTE_TABLE_H
+#define ROUTE_TABLE_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>    // bool
+#include <stdint.h>     // uint*_t
+
+/*      DEFINES                                                     */
+
+/* A routing table lists the containers of the network, as the detection
+** finds them. Besides the entries, it keeps indexes updated on each
+** addition, so that the lookups do not scan the table:
+** -    a direct array from the IDs, given from 1 by the detection,
+** -    an open addressing hash table from the aliases,
+** -    a list of the entries of each type, in detection order.
+** Entries are only added: the table is cleared before each detection.
+*/
+
+// Maximum size of an alias, terminating null char included.
+#define ROUTE_TABLE_ALIAS_SIZE  16
+
+// Number of container types.
+#define ROUTE_TABLE_NB_TYPES    256
+
+// ID of no container.
+#define ROUTE_TABLE_INVALID_ID  0
+
+// Index of no entry.
+#define ROUTE_TABLE_INVALID_IDX UINT16_MAX
+
+/* Number of slots of the alias hash table of a routing table of
+** `_max_entries` entries: a power of two, at least twice as many.
+*/
+#define ROUTE_TABLE_NB_SLOTS(_max_entries)                              \
+    ((_max_entries) <= 8 ? 16 : (_max_entries) <= 32 ? 64               \
+     : (_max_entries) <= 128 ? 256 : (_max_entries) <= 512 ? 1024       \
+     : 4096)
+
+/* Defines a routing table instance able to hold `_max_entries` entries,
+** and its indexes.
+*/
+#define ROUTE_TABLE_DEF(_name, _max_entries)                            \
+    static route_table_entry_t _name ## _entries[_max_entries];         \
+    static uint16_t _name ## _by_id[(_max_entries) + 1];                \
+    static uint16_t _name ## _by_alias[ROUTE_TABLE_NB_SLOTS(            \
+                                           _max_entries)];              \
+    static route_table_t _name =                                        \
+    {                                                                   \
+        .entries        = _name ## _entries,                            \
+        .max_entries    = (_max_entries),                               \
+        .by_id          = _name ## _by_id,                              \
+        .by_alias       = _name ## _by_alias,                           \
+        .nb_slots       = ROUTE_TABLE_NB_SLOTS(_max_entries),           \
+    }/*;*/
+
+// Routing table entry: one container.
+typedef struct
+{
+    // ID of the container.
+    uint16_t    id;
+
+    // ID of the node hosting the container.
+    uint16_t    node_id;
+
+    // Type of the container.
+    uint8_t     type;
+
+    // Alias of the container, null terminated.
+    char        alias[ROUTE_TABLE_ALIAS_SIZE];
+
+    // Index of the next entry of the same type.
+    uint16_t    next_of_type;
+} route_table_entry_t;
+
+// Routing table instance.
+typedef struct
+{
+    // Entries, in detection order.
+    route_table_entry_t*    entries;
+
+    // Maximum and current numbers of entries.
+    uint16_t                max_entries;
+    uint16_t                nb_entries;
+
+    // Entry index of each ID up to `max_entries`.
+    uint16_t*               by_id;
+
+    // Alias hash table of entry indexes, and its number of slots.
+    uint16_t*               by_alias;
+    uint16_t                nb_slots;
+
+    // First and last entry indexes of each type.
+    uint16_t                type_heads[ROUTE_TABLE_NB_TYPES];
+    uint16_t                type_tails[ROUTE_TABLE_NB_TYPES];
+} route_table_t;
+
+// Removes every entry of the given routing table.
+void route_table_clear(route_table_t* table);
+
+/* Adds a container to the given routing table. Returns false if the
+** table is full, or if the ID or alias is already used.
+*/
+bool route_table_add(route_table_t* table, uint16_t id, uint16_t node_id,
+                     uint8_t type, const char* alias);
+
+/* Returns the entry of the given ID in the given routing table, or NULL
+** if there is none.
+*/
+const route_table_entry_t* route_table_from_id(const route_table_t* table,
+                                               uint16_t id);
+
+/* Returns the ID of the container of the given alias in the given
+** routing table, or ROUTE_TABLE_INVALID_ID if there is none.
+*/
+uint16_t route_table_id_from_alias(const route_table_t* table,
+                                   const char* alias);
+
+/* Returns the ID of the node hosting the given container in the given
+** routing table, or ROUTE_TABLE_INVALID_ID if there is none.
+*/
+uint16_t route_table_node_from_id(const route_table_t* table, uint16_t id);
+
+/* Returns the first entry of the given type in the given routing table,
+** or NULL if there is none.
+*/
+const route_table_entry_t* route_table_type_first(
+    const route_table_t* table, uint8_t type);
+
+/* Returns the entry of the same type following the given one in the
+** given routing table, or NULL if there is none.
+*/
+const route_table_entry_t* route_table_type_next(
+    const route_table_t* table, const route_table_entry_t* entry);
+
+#endif /* ! ROUTE_TABLE_H */
@@ -0,0 +1,105 @@
+#include "run_loop.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdatomic.h>          // atomic_*
+#include <stdint.h>             // UINT32_MAX
+#include <string.h>             // memset
+
+// NRF
+#include "nrf_pwr_mgmt.h"       // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "sdk_errors.h"         // ret_code_t
+
+// NRF APPS
+#include "app_error.h"          // APP_ERROR_CHECK
+#include "app_timer.h"          // app_timer_*, APP_TIMER_*
+
+/*      CALLBACKS                                                   */
+
+// Raises the tick event on the instance given as context.
+static void run_loop_tick(void* context);
+
+void run_loop_init(run_loop_t* instance, const run_loop_init_t* parameters)
+{
+    memset(instance, 0, sizeof(run_loop_t));
+
+    instance->tasks     = parameters->tasks;
+    instance->nb_tasks  = parameters->nb_tasks;
+    instance->timer_id  = &(instance->timer_data);
+
+    // First round: every module loop.
+    atomic_store(&(instance->events), UINT32_MAX);
+
+    ret_code_t err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    if (parameters->tick_period_ms == 0)
+    {
+        return;
+    }
+
+    err_code = app_timer_create(&(instance->timer_id),
+                                APP_TIMER_MODE_REPEATED, run_loop_tick);
+    APP_ERROR_CHECK(err_code);
+
+    err_code = app_timer_start(instance->timer_id,
+                               APP_TIMER_TICKS(parameters->tick_period_ms),
+                               instance);
+    APP_ERROR_CHECK(err_code);
+}
+
+void run_loop_evt_set(run_loop_t* instance, uint32_t events)
+{
+    atomic_fetch_or(&(instance->events), events);
+}
+
+bool run_loop_step(run_loop_t* instance)
+{
+    uint32_t events = atomic_exchange(&(instance->events), 0);
+
+    if (events == 0)
+    {
+        /* An event raised by an interrupt since the exchange does not get
+        ** lost: the interrupt leaves the event register set, and the CPU
+        ** does not go to sleep.
+        */
+        instance->stats.sleep_count++;
+        nrf_pwr_mgmt_run();
+
+        return false;
+    }
+
+    instance->stats.iteration_count++;
+
+    for (uint8_t task_idx = 0; task_idx < instance->nb_tasks; task_idx++)
+    {
+        const run_loop_task_t* task = &(instance->tasks[task_idx]);
+
+        if ((task->evt_mask & events) != 0)
+        {
+            instance->stats.task_count[task_idx]++;
+            task->fn();
+        }
+    }
+
+    return true;
+}
+
+void run_loop_run(run_loop_t* instance)
+{
+    while (true)
+    {
+        run_loop_step(instance);
+    }
+}
+
+void run_loop_on_ble_evt(ble_evt_t const* event, void* context)
+{
+    run_loop_evt_set((run_loop_t*)context, RUN_LOOP_EVT_BLE);
+}
+
+static void run_loop_tick(void* context)
+{
+    run_loop_evt_set((run_loop_t*)context, RUN_LOOP_EVT_TICK);
+}
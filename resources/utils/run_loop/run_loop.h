@@ -0,0 +1,135 @@
+#ifndef RUN_LOOP_H
+#define RUN_LOOP_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdatomic.h>      // _Atomic
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+
+// NRF
+#include "nrf_sdh_ble.h"    // NRF_SDH_BLE_OBSERVER
+
+// NRF APPS
+#include "app_timer.h"      // app_timer_t, app_timer_id_t
+
+// SOFTDEVICE
+#include "ble.h"            // ble_evt_t
+
+/*      CONSTANTS                                                   */
+
+/* The run loop replaces a main loop calling every module loop as fast as
+** it can. Interrupt handlers set event flags instead, and the run loop
+** only calls the loops of the modules concerned by the pending events.
+** When no event is pending, the CPU sleeps until the next interrupt.
+**
+** BLE events and ticks are raised by the run loop itself, and UART events
+** by the function given to uart_rx_notify_set. The other events shall be
+** raised by the modules receiving the data: a module loop polled on a
+** tick only is late by up to a tick period. A module loop returning with
+** work left shall raise its event again.
+*/
+
+// Run loop BLE observer priority: after the modules handling the events.
+#define RUN_LOOP_BLE_OBS_PRIO       3
+
+// Events waking the run loop up.
+#define RUN_LOOP_EVT_BLE            (1 << 0)
+#define RUN_LOOP_EVT_UART           (1 << 1)
+#define RUN_LOOP_EVT_LUOS_RX        (1 << 2)
+#define RUN_LOOP_EVT_TICK           (1 << 3)
+
+// First event free for the application.
+#define RUN_LOOP_EVT_APP            (1 << 8)
+
+// Maximum number of module loops.
+#define RUN_LOOP_MAX_TASKS          8
+
+// Defines a run loop instance and assigns its BLE observer.
+#define RUN_LOOP_DEF(_instance_name)                    \
+    static run_loop_t _instance_name;                   \
+    NRF_SDH_BLE_OBSERVER(_instance_name ## _ble_obs,    \
+        RUN_LOOP_BLE_OBS_PRIO,                          \
+        run_loop_on_ble_evt,                            \
+        &_instance_name                                 \
+    )/*;*/
+
+// Module loop called by the run loop.
+typedef void (*run_loop_task_fn_t)(void);
+
+// Module loop, and the events it shall be called on.
+typedef struct
+{
+    run_loop_task_fn_t  fn;
+    uint32_t            evt_mask;
+} run_loop_task_t;
+
+// Parameters needed to initialize a run loop instance.
+typedef struct
+{
+    // Module loops, called in the given order. At most RUN_LOOP_MAX_TASKS.
+    const run_loop_task_t*  tasks;
+    uint8_t                 nb_tasks;
+
+    // Period of the tick event, or 0 for no tick.
+    uint32_t                tick_period_ms;
+} run_loop_init_t;
+
+// Statistics of a run loop instance.
+typedef struct
+{
+    // Number of rounds which called the module loops.
+    uint32_t    iteration_count;
+
+    // Number of rounds which found no event and slept.
+    uint32_t    sleep_count;
+
+    // Number of times each module loop was called.
+    uint32_t    task_count[RUN_LOOP_MAX_TASKS];
+} run_loop_stats_t;
+
+// Run loop instance.
+typedef struct
+{
+    // Module loops.
+    const run_loop_task_t*  tasks;
+    uint8_t                 nb_tasks;
+
+    // Events raised since the last round.
+    _Atomic uint32_t        events;
+
+    // Tick timer.
+    app_timer_t             timer_data;
+    app_timer_id_t          timer_id;
+
+    // Statistics.
+    run_loop_stats_t        stats;
+} run_loop_t;
+
+/* Initializes the given run loop instance with the given parameters, and
+** the power management module. The app_timer module shall already be
+** initialized if a tick is wanted. Every module loop is called once at
+** the first round, as the modules may have work left from their
+** initialization.
+*/
+void run_loop_init(run_loop_t* instance, const run_loop_init_t* parameters);
+
+/* Raises the given events on the given instance, and wakes it up. Can be
+** called from any context.
+*/
+void run_loop_evt_set(run_loop_t* instance, uint32_t events);
+
+/* Runs a round of the given instance: calls the module loops concerned by
+** the pending events, or sleeps until the next interrupt if there is
+** none. Returns false if the round slept.
+*/
+bool run_loop_step(run_loop_t* instance);
+
+// Runs the rounds of the given instance forever.
+void run_loop_run(run_loop_t* instance);
+
+// Any event:   Raises the BLE event.
+void run_loop_on_ble_evt(ble_evt_t const* event, void* context);
+
+#endif /* ! RUN_LOOP_H */
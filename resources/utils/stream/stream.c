@@ -0,0 +1,210 @@
+#include "stream.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdatomic.h>  // atomic_*
+#include <stddef.h>     // NULL
+#include <string.h>     // memcpy, memset
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Reserves a new chunk in the queue of the given sender and writes its
+** header. Returns false if the queue is full.
+*/
+static bool stream_tx_chunk_open(stream_tx_t* tx);
+
+/* Commits the chunk of the given sender and hands it to the link.
+** Returns false if there is no credit for it.
+*/
+static bool stream_tx_chunk_commit(stream_tx_t* tx);
+
+// Sends at most STREAM_MAX_WINDOW credits of the given receiver.
+static void stream_rx_credits_send(stream_rx_t* rx);
+
+void stream_tx_init(stream_tx_t* tx, const stream_tx_init_t* parameters)
+{
+    memset(tx, 0, sizeof(stream_tx_t));
+
+    tx->queue   = parameters->queue;
+    tx->channel = parameters->channel & STREAM_CHANNEL_MASK;
+    atomic_init(&(tx->credits), parameters->window);
+    tx->kick    = parameters->kick;
+}
+
+uint16_t stream_tx_write(stream_tx_t* tx, const uint8_t* data,
+                         uint16_t size)
+{
+    uint16_t chunk_size = tx->queue->slot_size;
+    uint16_t written    = 0;
+
+    while (written < size)
+    {
+        if ((tx->chunk == NULL) && !stream_tx_chunk_open(tx))
+        {
+            break;
+        }
+
+        uint16_t room = chunk_size - tx->chunk_fill;
+        if (room == 0)
+        {
+            if (!stream_tx_chunk_commit(tx))
+            {
+                break;
+            }
+            continue;
+        }
+
+        uint16_t count = (size - written < room) ? size - written : room;
+
+        memcpy(tx->chunk + tx->chunk_fill, data + written, count);
+        tx->chunk_fill  += count;
+        written         += count;
+    }
+
+    // Send a full chunk right away rather than on the next write.
+    if ((tx->chunk != NULL) && (tx->chunk_fill == chunk_size))
+    {
+        stream_tx_chunk_commit(tx);
+    }
+
+    tx->stats.written_bytes += written;
+    tx->stats.refused_bytes += size - written;
+
+    return written;
+}
+
+void stream_tx_flush(stream_tx_t* tx)
+{
+    if ((tx->chunk != NULL) && (tx->chunk_fill > STREAM_HEADER_SIZE))
+    {
+        stream_tx_chunk_commit(tx);
+    }
+}
+
+bool stream_tx_on_msg(stream_tx_t* tx, const uint8_t* data, uint16_t size)
+{
+    if ((size < STREAM_HEADER_SIZE)
+        || (data[0] != (STREAM_CREDITS | tx->channel)))
+    {
+        return false;
+    }
+
+    atomic_fetch_add(&(tx->credits), data[1]);
+
+    return true;
+}
+
+void stream_rx_init(stream_rx_t* rx, const stream_rx_init_t* parameters)
+{
+    memset(rx, 0, sizeof(stream_rx_t));
+
+    rx->channel     = parameters->channel & STREAM_CHANNEL_MASK;
+    rx->grant_size  = (parameters->window > 1) ? parameters->window / 2 : 1;
+    rx->send        = parameters->send;
+}
+
+bool stream_rx_on_msg(stream_rx_t* rx, const uint8_t* data, uint16_t size,
+                      const uint8_t** payload, uint16_t* payload_size)
+{
+    if ((size < STREAM_HEADER_SIZE)
+        || (data[0] != (STREAM_DATA | rx->channel)))
+    {
+        return false;
+    }
+
+    uint8_t nb_lost = data[1] - rx->expected_seq;
+    if (nb_lost > 0)
+    {
+        // The credits of the lost chunks are given back.
+        rx->stats.lost_count    += nb_lost;
+        rx->to_grant            += nb_lost;
+    }
+
+    rx->expected_seq = data[1] + 1;
+
+    rx->stats.chunk_count++;
+    rx->stats.rx_bytes += size - STREAM_HEADER_SIZE;
+
+    *payload        = data + STREAM_HEADER_SIZE;
+    *payload_size   = size - STREAM_HEADER_SIZE;
+
+    return true;
+}
+
+void stream_rx_release(stream_rx_t* rx, uint16_t count)
+{
+    rx->to_grant += count;
+
+    if (rx->to_grant >= rx->grant_size)
+    {
+        stream_rx_credits_send(rx);
+    }
+}
+
+void stream_rx_credits_kick(stream_rx_t* rx)
+{
+    if (rx->to_grant > 0)
+    {
+        stream_rx_credits_send(rx);
+    }
+}
+
+static bool stream_tx_chunk_open(stream_tx_t* tx)
+{
+    tx->chunk = msg_queue_inst_reserve(tx->queue, tx->queue->slot_size);
+    if (tx->chunk == NULL)
+    {
+        return false;
+    }
+
+    tx->chunk[0]    = STREAM_DATA | tx->channel;
+    tx->chunk[1]    = tx->seq;
+    tx->chunk_fill  = STREAM_HEADER_SIZE;
+
+    return true;
+}
+
+static bool stream_tx_chunk_commit(stream_tx_t* tx)
+{
+    // Only the producer takes credits: they cannot drop to 0 meanwhile.
+    if (atomic_load(&(tx->credits)) == 0)
+    {
+        if (!tx->stalled)
+        {
+            tx->stats.credit_stall_count++;
+            tx->stalled = true;
+        }
+        return false;
+    }
+
+    msg_queue_inst_commit(tx->queue, tx->chunk_fill);
+
+    atomic_fetch_sub(&(tx->credits), 1);
+    tx->seq++;
+    tx->chunk   = NULL;
+    tx->stalled = false;
+    tx->stats.chunk_count++;
+
+    if (tx->kick != NULL)
+    {
+        tx->kick();
+    }
+
+    return true;
+}
+
+static void stream_rx_credits_send(stream_rx_t* rx)
+{
+    uint8_t msg[STREAM_HEADER_SIZE];
+
+    msg[0] = STREAM_CREDITS | rx->channel;
+    msg[1] = (rx->to_grant < STREAM_MAX_WINDOW) ? rx->to_grant
+                                                : STREAM_MAX_WINDOW;
+
+    if ((rx->send != NULL) && rx->send(msg, STREAM_HEADER_SIZE))
+    {
+        rx->to_grant -= msg[1];
+        rx->stats.grant_count++;
+    }
+}
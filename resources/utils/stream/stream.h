@@ -0,0 +1,216 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdatomic.h>  // _Atomic
+#include <stdbool.h>    // bool
+#include <stdint.h>     // uint*_t
+
+// CUSTOM
+#include "msg_queue.h"  // msg_queue_t
+
+/*      DEFINES                                                     */
+
+/* A streaming channel carries a continuous byte stream, such as sensor
+** samples, over the BLE link in chunks as large as the link allows.
+**
+** The sender writes the stream directly in the chunk reserved in its
+** message queue: this is the only copy, as the L2CAP backend hands the
+** queued chunks to the stack without copy. A full chunk is committed,
+** and kicked to the link, only when the receiver granted a credit for
+** it. The receiver starts with a window of chunks, and grants credits
+** back as the application consumes them, half a window at a time. Out
+** of credits, the sender keeps its last chunk and refuses the stream:
+** the producer, not the link, drops the samples. Received credits only
+** add to the sender's count: the waiting chunk is committed by the next
+** write or flush, as the queue has a single producer.
+**
+** Each chunk starts with a header:
+** -    byte 0: STREAM_DATA and the channel number,
+** -    byte 1: chunk sequence number, to detect losses.
+** Credits are granted by 2-byte messages:
+** -    byte 0: STREAM_CREDITS and the channel number,
+** -    byte 1: number of granted credits.
+** The transport shall tell these messages from the other ones.
+**
+** Sending functions shall be called from the queue producer context,
+** receiving functions, stream_tx_on_msg included, from the context the
+** messages are received in.
+*/
+
+// Size of the header of the stream messages.
+#define STREAM_HEADER_SIZE      2
+
+// Message kinds, in the first header byte.
+#define STREAM_DATA             0x40
+#define STREAM_CREDITS          0x80
+#define STREAM_KIND_MASK        0xC0
+#define STREAM_CHANNEL_MASK     0x3F
+
+// Largest number of credits a message grants.
+#define STREAM_MAX_WINDOW       UINT8_MAX
+
+// Hands the committed chunks to the link.
+typedef void(*stream_kick_t)(void);
+
+/* Sends the given credits message to the peer. Returns false if it
+** cannot be sent now.
+*/
+typedef bool(*stream_send_t)(const uint8_t* data, uint16_t size);
+
+// Statistics of a streaming channel sender.
+typedef struct
+{
+    // Number of stream bytes written and refused.
+    uint32_t    written_bytes;
+    uint32_t    refused_bytes;
+
+    // Number of committed chunks.
+    uint32_t    chunk_count;
+
+    // Number of times a full chunk waited for a credit.
+    uint32_t    credit_stall_count;
+} stream_tx_stats_t;
+
+// Parameters needed to initialize a streaming channel sender.
+typedef struct
+{
+    // Queue of the chunks, whose slot size is the chunk size.
+    msg_queue_t*    queue;
+
+    // Channel number, at most STREAM_CHANNEL_MASK.
+    uint8_t         channel;
+
+    // Window of the receiver, in chunks.
+    uint8_t         window;
+
+    // Function handing the committed chunks to the link, or NULL.
+    stream_kick_t   kick;
+} stream_tx_init_t;
+
+// Streaming channel sender instance.
+typedef struct
+{
+    // Queue of the chunks.
+    msg_queue_t*        queue;
+
+    // Channel number.
+    uint8_t             channel;
+
+    // Chunks the receiver can still take, granted from the RX context.
+    _Atomic uint16_t    credits;
+
+    // Sequence number of the next chunk.
+    uint8_t             seq;
+
+    // Chunk being written in the queue, or NULL.
+    uint8_t*            chunk;
+
+    // Bytes written in the chunk, header included.
+    uint16_t            chunk_fill;
+
+    // Function handing the committed chunks to the link.
+    stream_kick_t       kick;
+
+    // Set while a full chunk waits for a credit.
+    bool                stalled;
+
+    // Statistics.
+    stream_tx_stats_t   stats;
+} stream_tx_t;
+
+// Statistics of a streaming channel receiver.
+typedef struct
+{
+    // Number of received chunks and stream bytes.
+    uint32_t    chunk_count;
+    uint32_t    rx_bytes;
+
+    // Number of chunks missing from the sequence.
+    uint32_t    lost_count;
+
+    // Number of sent credits messages.
+    uint32_t    grant_count;
+} stream_rx_stats_t;
+
+// Parameters needed to initialize a streaming channel receiver.
+typedef struct
+{
+    // Channel number, at most STREAM_CHANNEL_MASK.
+    uint8_t         channel;
+
+    // Number of chunks the receiver can hold until they are consumed.
+    uint8_t         window;
+
+    // Function sending the credits messages.
+    stream_send_t   send;
+} stream_rx_init_t;
+
+// Streaming channel receiver instance.
+typedef struct
+{
+    // Channel number.
+    uint8_t             channel;
+
+    // Number of credits granted at once.
+    uint8_t             grant_size;
+
+    // Sequence number of the next chunk.
+    uint8_t             expected_seq;
+
+    // Credits to grant.
+    uint16_t            to_grant;
+
+    // Function sending the credits messages.
+    stream_send_t       send;
+
+    // Statistics.
+    stream_rx_stats_t   stats;
+} stream_rx_t;
+
+/* Initializes the given streaming channel sender with the given
+** parameters. The sender starts with a window of credits.
+*/
+void stream_tx_init(stream_tx_t* tx, const stream_tx_init_t* parameters);
+
+/* Writes the given stream bytes in the chunks of the given sender, and
+** commits the chunks filled. Returns the number of bytes written: less
+** than `size` if the sender is out of credits or queue room.
+*/
+uint16_t stream_tx_write(stream_tx_t* tx, const uint8_t* data,
+                         uint16_t size);
+
+/* Commits the chunk being written by the given sender, even if it is not
+** full, if it holds stream bytes and a credit is available.
+*/
+void stream_tx_flush(stream_tx_t* tx);
+
+/* Handles the given message received by the given sender. Returns true
+** if it was a credits message of its channel. Only adds the credits: a
+** chunk waiting for them is committed by the next write or flush.
+*/
+bool stream_tx_on_msg(stream_tx_t* tx, const uint8_t* data, uint16_t size);
+
+// Initializes the given streaming channel receiver with the given parameters.
+void stream_rx_init(stream_rx_t* rx, const stream_rx_init_t* parameters);
+
+/* Handles the given message received by the given receiver. Returns true
+** if it was a chunk of its channel, and then points `payload` to its
+** stream bytes. Every chunk shall be released once consumed.
+*/
+bool stream_rx_on_msg(stream_rx_t* rx, const uint8_t* data, uint16_t size,
+                      const uint8_t** payload, uint16_t* payload_size);
+
+/* Releases the given number of consumed chunks of the given receiver, and
+** grants their credits back once there are enough of them.
+*/
+void stream_rx_release(stream_rx_t* rx, uint16_t count);
+
+/* Sends the credits the given receiver still has to grant, if any. Shall
+** be called when the link can take a message again after a failed send.
+*/
+void stream_rx_credits_kick(stream_rx_t* rx);
+
+#endif /* ! STREAM_H */
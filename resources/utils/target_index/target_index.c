@@ -0,0 +1,148 @@
+#include "target_index.h"
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stddef.h>     // NULL
+#include <string.h>     // memset
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Target of the broadcast messages.
+#define TARGET_INDEX_BROADCAST_ID   0x0FFF
+
+/*      STATIC FUNCTIONS                                            */
+
+// Sets the given bit of the given bitmap.
+static void target_index_bit_set(uint32_t* bitmap, uint16_t bit);
+
+// Clears the given bit of the given bitmap.
+static void target_index_bit_clear(uint32_t* bitmap, uint16_t bit);
+
+// Returns the given bit of the given bitmap.
+static bool target_index_bit_get(const uint32_t* bitmap, uint16_t bit);
+
+/* Returns the entry of the given multicast group in the given index, or
+** NULL if no local container listens to it.
+*/
+static target_index_group_t* target_index_group_find(target_index_t* index,
+                                                     uint16_t group);
+
+void target_index_clear(target_index_t* index)
+{
+    memset(index, 0, sizeof(target_index_t));
+}
+
+void target_index_node_set(target_index_t* index, uint16_t node_id)
+{
+    index->node_id = node_id % TARGET_INDEX_NB_IDS;
+}
+
+void target_index_container_add(target_index_t* index, uint16_t id,
+                                uint8_t type)
+{
+    target_index_bit_set(index->ids, id % TARGET_INDEX_NB_IDS);
+    target_index_bit_set(index->types, type);
+}
+
+bool target_index_group_add(target_index_t* index, uint16_t group)
+{
+    group %= TARGET_INDEX_NB_IDS;
+
+    target_index_group_t* entry = target_index_group_find(index, group);
+    if (entry == NULL)
+    {
+        if (index->nb_groups == TARGET_INDEX_MAX_GROUPS)
+        {
+            return false;
+        }
+
+        entry               = &(index->group_refs[index->nb_groups++]);
+        entry->group        = group;
+        entry->nb_listeners = 0;
+
+        target_index_bit_set(index->groups, group);
+    }
+
+    entry->nb_listeners++;
+
+    return true;
+}
+
+void target_index_group_remove(target_index_t* index, uint16_t group)
+{
+    group %= TARGET_INDEX_NB_IDS;
+
+    target_index_group_t* entry = target_index_group_find(index, group);
+    if (entry == NULL)
+    {
+        // No container listens to it.
+        return;
+    }
+
+    entry->nb_listeners--;
+    if (entry->nb_listeners > 0)
+    {
+        return;
+    }
+
+    // Last listener: the last entry takes the place of the removed one.
+    *entry = index->group_refs[--index->nb_groups];
+
+    target_index_bit_clear(index->groups, group);
+}
+
+bool target_index_match(const target_index_t* index, uint8_t mode,
+                        uint16_t target)
+{
+    target %= TARGET_INDEX_NB_IDS;
+
+    switch (mode)
+    {
+    case TARGET_INDEX_MODE_ID:
+    case TARGET_INDEX_MODE_IDACK:
+        return target_index_bit_get(index->ids, target);
+    case TARGET_INDEX_MODE_TYPE:
+        return (target < TARGET_INDEX_NB_TYPES)
+               && target_index_bit_get(index->types, target);
+    case TARGET_INDEX_MODE_BROADCAST:
+        return (target == TARGET_INDEX_BROADCAST_ID);
+    case TARGET_INDEX_MODE_MULTICAST:
+        return target_index_bit_get(index->groups, target);
+    case TARGET_INDEX_MODE_NODEID:
+    case TARGET_INDEX_MODE_NODEIDACK:
+        // Before the detection, every node answers to node ID 0.
+        return (target == index->node_id);
+    default:
+        return false;
+    }
+}
+
+static void target_index_bit_set(uint32_t* bitmap, uint16_t bit)
+{
+    bitmap[bit / 32] |= (1UL << (bit % 32));
+}
+
+static void target_index_bit_clear(uint32_t* bitmap, uint16_t bit)
+{
+    bitmap[bit / 32] &= ~(1UL << (bit % 32));
+}
+
+static bool target_index_bit_get(const uint32_t* bitmap, uint16_t bit)
+{
+    return (bitmap[bit / 32] >> (bit % 32)) & 1;
+}
+
+static target_index_group_t* target_index_group_find(target_index_t* index,
+                                                     uint16_t group)
+{
+    for (uint8_t group_idx = 0; group_idx < index->nb_groups; group_idx++)
+    {
+        if (index->group_refs[group_idx].group == group)
+        {
+            return &(index->group_refs[group_idx]);
+        }
+    }
+
+    return NULL;
+}
@@ -0,0 +1,96 @@
+#ifndef TARGET_INDEX_H
+#define TARGET_INDEX_H
+
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>    // bool
+#include <stdint.h>     // uint*_t
+
+/*      DEFINES                                                     */
+
+/* A target index tells whether a message is addressed to the local
+** containers with a single bit test, as soon as its header is received,
+** instead of scanning the containers. It holds one bit per container ID,
+** type and multicast group of the node, and shall be rebuilt whenever
+** the IDs change, i.e. on each detection. Several containers can listen
+** to the same group: its bit is cleared once the last one leaves it.
+*/
+
+// Number of container IDs and multicast groups: 12-bit targets.
+#define TARGET_INDEX_NB_IDS     4096
+
+// Number of container types.
+#define TARGET_INDEX_NB_TYPES   256
+
+// Maximum number of distinct multicast groups listened to by a node.
+#define TARGET_INDEX_MAX_GROUPS 64
+
+// Target modes of a message header.
+typedef enum
+{
+    TARGET_INDEX_MODE_ID,
+    TARGET_INDEX_MODE_IDACK,
+    TARGET_INDEX_MODE_TYPE,
+    TARGET_INDEX_MODE_BROADCAST,
+    TARGET_INDEX_MODE_MULTICAST,
+    TARGET_INDEX_MODE_NODEID,
+    TARGET_INDEX_MODE_NODEIDACK,
+} target_index_mode_t;
+
+// Multicast group, and the number of local containers listening to it.
+typedef struct
+{
+    uint16_t    group;
+    uint16_t    nb_listeners;
+} target_index_group_t;
+
+// Target index instance.
+typedef struct
+{
+    // One bit per ID of a local container.
+    uint32_t    ids[TARGET_INDEX_NB_IDS / 32];
+
+    // One bit per type of a local container.
+    uint32_t    types[TARGET_INDEX_NB_TYPES / 32];
+
+    // One bit per multicast group a local container listens to.
+    uint32_t    groups[TARGET_INDEX_NB_IDS / 32];
+
+    // Groups listened to, in no particular order.
+    target_index_group_t    group_refs[TARGET_INDEX_MAX_GROUPS];
+    uint8_t                 nb_groups;
+
+    // ID of the node, 0 before the detection.
+    uint16_t    node_id;
+} target_index_t;
+
+// Empties the given index, before the containers are added again.
+void target_index_clear(target_index_t* index);
+
+// Sets the ID of the node of the given index.
+void target_index_node_set(target_index_t* index, uint16_t node_id);
+
+// Adds a local container of the given ID and type to the given index.
+void target_index_container_add(target_index_t* index, uint16_t id,
+                                uint8_t type);
+
+/* Adds a local container listening to the given multicast group to the
+** given index. Returns false if the group is new and the index already
+** holds TARGET_INDEX_MAX_GROUPS groups.
+*/
+bool target_index_group_add(target_index_t* index, uint16_t group);
+
+/* Removes a local container listening to the given multicast group from
+** the given index. The group stays in the index while other containers
+** listen to it.
+*/
+void target_index_group_remove(target_index_t* index, uint16_t group);
+
+/* Returns true if a message with the given target mode and target is
+** addressed to a container of the given index.
+*/
+bool target_index_match(const target_index_t* index, uint8_t mode,
+                        uint16_t target);
+
+#endif /* ! TARGET_INDEX_H */
@@ -1,59 +1,367 @@
 #include "uart_helpers.h"
 
 // C STANDARD
+#include <errno.h>              // errno, EAGAIN
+#include <stdatomic.h>          // atomic_*, memory_order_*
 #include <stdbool.h>            // bool
-#include <stdint.h>             // uint32_t
-#include <string.h>             // memset
+#include <stddef.h>             // NULL
+#include <stdint.h>             // uint*_t
+#include <string.h>             // memcpy, memset
 
 // NRF
-#include "boards.h"             /* RX_PIN_NUMBER, TX_PIN_NUMBER,
-                                ** APP_UART_FLOW_CONTROL_DISABLED
+#include "boards.h"             // *_PIN_NUMBER
+#include "nrf_drv_gpiote.h"     /* nrf_drv_gpiote_*,
+                                ** GPIOTE_CONFIG_IN_SENSE_HITOLO
                                 */
-#include "nrf_uart.h"           // NRF_UART_BAUDRATE_115200
+#include "nrf_drv_uart.h"       // nrf_drv_uart_*, NRF_DRV_UART_*
+#include "nrf_uarte.h"          /* nrf_uarte_event_*, nrf_uarte_baudrate_set,
+                                ** nrf_uarte_configure, NRF_UARTE_*
+                                */
+#include "nrf_uart.h"           /* nrf_uart_baudrate_t, NRF_UART_HWFC_*,
+                                ** NRF_UART_PARITY_EXCLUDED
+                                */
+#include "sdk_errors.h"         // ret_code_t
 
 // NRF APPS
 #include "app_error.h"          // APP_ERROR_CHECK
-#include "app_uart.h"           // app_uart_*, APP_UART_FIFO_INIT
-#include "app_util_platform.h"  // APP_IRQ_PRIORITY_LOWEST
+#include "app_timer.h"          // APP_TIMER_DEF, app_timer_*
+#include "app_uart.h"           // app_uart_evt_t, APP_UART_*
+#include "app_util_platform.h"  /* APP_IRQ_PRIORITY_*,
+                                ** current_int_priority_get,
+                                ** CRITICAL_REGION_*
+                                */
 
-void uart_init(const app_uart_event_handler_t handler)
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Maximum size of a single EasyDMA transfer.
+#define TX_DMA_MAX_SIZE     UINT8_MAX
+
+// Number of reception buffers, used in turn.
+#define RX_NB_BUFFERS       2
+
+// UART driver instance.
+static const nrf_drv_uart_t     s_uart          = NRF_DRV_UART_INSTANCE(0);
+
+// Application event handler.
+static app_uart_event_handler_t s_evt_handler   = NULL;
+
+// Function called once received data is handed to the application.
+static uart_rx_notify_t         s_rx_notify     = NULL;
+
+// Reception buffers.
+static uint8_t                  s_rx_buffers[RX_NB_BUFFERS][RX_BUFFER_SIZE];
+
+// Size of the reception buffers given to the driver.
+static uint16_t                 s_rx_buffer_size    = RX_BUFFER_SIZE;
+
+// Number of bytes received in each reception buffer.
+static uint16_t                 s_rx_sizes[RX_NB_BUFFERS];
+
+/* Number of reception buffers ever given to the driver. The buffer
+** concerned by this counter and the two next ones is given by their
+** value modulo the number of buffers. Only accessed in critical regions.
+*/
+static uint8_t                  s_rx_nb_armed       = 0;
+
+/* Number of reception buffers ever filled. Only written by the driver
+** event handler, released once the buffer size is stored.
+*/
+static _Atomic uint8_t          s_rx_nb_filled      = 0;
+
+/* Number of reception buffers ever released. Only written by the
+** consumer, released once the buffer is not accessed anymore.
+*/
+static _Atomic uint8_t          s_rx_nb_released    = 0;
+
+// Offset of the next byte to read with `_read` in the borrowed buffer.
+static uint16_t                 s_rx_read_offset    = 0;
+
+/* Timer detecting that the line became idle. Only running while bytes
+** are being received.
+*/
+APP_TIMER_DEF(s_rx_idle_timer);
+
+// Bytes waiting to be sent.
+static uint8_t                  s_tx_ring[TX_RING_SIZE];
+
+/* Number of bytes ever written in the sending ring. Only written by
+** `_write`, released once the bytes are copied.
+*/
+static _Atomic uint32_t         s_tx_head       = 0;
+
+/* Number of bytes ever sent from the sending ring. Only written by the
+** owner of the transfer, released once the bytes are sent.
+*/
+static _Atomic uint32_t         s_tx_tail       = 0;
+
+/* True while a context owns the sending ring tail, i.e. while a transfer
+** is ongoing or being started.
+*/
+static atomic_bool              s_tx_busy       = false;
+
+// Baudrate to switch to once the sending ring is empty.
+static nrf_uart_baudrate_t      s_link_baudrate;
+
+// Flow control to switch to once the sending ring is empty.
+static bool                     s_link_flow_control;
+
+/* True if a switch is waiting for the sending ring to be empty. Released
+** once the parameters above are stored.
+*/
+static atomic_bool              s_link_pending  = false;
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Starts the transfer of the next contiguous part of the sending ring.
+** Shall only be called by the owner of the transfer. Returns false if
+** there is nothing to send.
+*/
+static bool tx_chunk_start(void);
+
+/* Starts a transfer if none is ongoing and there is something to send.
+** Can be called from any context.
+*/
+static void tx_kick(void);
+
+/* Applies the waiting baudrate and flow control switch, if any. Shall
+** only be called by the owner of the transfer, once the sending ring is
+** empty.
+*/
+static void link_pending_apply(void);
+
+/* Gives the driver as many free reception buffers as possible. Can be
+** called from any context.
+*/
+static void rx_buffers_arm(void);
+
+/* Registers the given amount of bytes received in the current buffer,
+** and arms the free buffers.
+*/
+static void rx_on_done(uint16_t nb_bytes);
+
+// Forwards the given event to the application event handler, if any.
+static void app_evt_send(app_uart_evt_t* event);
+
+/*      CALLBACKS                                                   */
+
+/* TX done:     Sends the next part of the sending ring, or notifies the
+**              application that everything was sent.
+** RX done:     Registers the received buffer, full or handed over by the
+**              idle timer, and notifies the application.
+** Error:       Notifies the application.
+*/
+static void uart_evt_handler(nrf_drv_uart_event_t* event, void* context);
+
+/* Start bit on the RX pin: stops watching the pin and starts the idle
+** timer.
+*/
+static void rx_pin_handler(nrf_drv_gpiote_pin_t pin,
+                           nrf_gpiote_polarity_t action);
+
+/* If bytes were received since the timer was started, starts it again.
+** Else, stops the reception so that the partially filled buffer is
+** handed to the application, and watches the RX pin again.
+*/
+static void rx_idle_timer_handler(void* context);
+
+void uart_init_ex(const uart_init_t* parameters)
 {
-    app_uart_comm_params_t params;
-    memset(&params, 0, sizeof(app_uart_comm_params_t));
-
-    params.rx_pin_no    = RX_PIN_NUMBER;
-    params.tx_pin_no    = TX_PIN_NUMBER;
-    params.rts_pin_no   = RTS_PIN_NUMBER;
-    params.cts_pin_no   = CTS_PIN_NUMBER;
-    params.flow_control = APP_UART_FLOW_CONTROL_DISABLED;
-    params.use_parity   = false;
-    params.baud_rate    = NRF_UART_BAUDRATE_115200;
-
-    uint32_t err_code;
-    APP_UART_FIFO_INIT(
-        &params,
-        RX_FIFO_SIZE,
-        TX_FIFO_SIZE,
-        handler,
-        APP_IRQ_PRIORITY_LOWEST,
-        err_code
-    );
+    s_evt_handler = parameters->evt_handler;
+
+    s_rx_buffer_size = parameters->rx_buffer_size;
+    if ((s_rx_buffer_size == 0) || (s_rx_buffer_size > RX_BUFFER_SIZE))
+    {
+        // Reception buffers cannot grow: use them entirely.
+        s_rx_buffer_size = RX_BUFFER_SIZE;
+    }
+
+    nrf_drv_uart_config_t config = NRF_DRV_UART_DEFAULT_CONFIG;
+
+    config.pselrxd              = RX_PIN_NUMBER;
+    config.pseltxd              = TX_PIN_NUMBER;
+    config.pselrts              = RTS_PIN_NUMBER;
+    config.pselcts              = CTS_PIN_NUMBER;
+    /* The driver only connects the RTS/CTS pins when flow control is
+    ** enabled: enable it at first, so that it can be switched on later.
+    */
+    config.hwfc                 = NRF_UART_HWFC_ENABLED;
+    config.parity               = NRF_UART_PARITY_EXCLUDED;
+    config.baudrate             = parameters->baudrate;
+    config.interrupt_priority   = APP_IRQ_PRIORITY_LOWEST;
+
+    ret_code_t err_code = nrf_drv_uart_init(&s_uart, &config,
+                                            uart_evt_handler);
+    APP_ERROR_CHECK(err_code);
+
+    if (!parameters->flow_control)
+    {
+        nrf_uarte_configure(s_uart.uarte.p_reg, NRF_UARTE_PARITY_EXCLUDED,
+                            NRF_UARTE_HWFC_DISABLED);
+    }
+
+    rx_buffers_arm();
+
+    err_code = app_timer_create(&s_rx_idle_timer,
+                                APP_TIMER_MODE_SINGLE_SHOT,
+                                rx_idle_timer_handler);
+    APP_ERROR_CHECK(err_code);
+
+    if (!nrf_drv_gpiote_is_init())
+    {
+        err_code = nrf_drv_gpiote_init();
+        APP_ERROR_CHECK(err_code);
+    }
+
+    // Low accuracy: the port event does not keep a clock running.
+    nrf_drv_gpiote_in_config_t pin_config =
+        GPIOTE_CONFIG_IN_SENSE_HITOLO(false);
+
+    err_code = nrf_drv_gpiote_in_init(RX_PIN_NUMBER, &pin_config,
+                                      rx_pin_handler);
     APP_ERROR_CHECK(err_code);
+
+    nrf_drv_gpiote_in_event_enable(RX_PIN_NUMBER, true);
+}
+
+void uart_init(const app_uart_event_handler_t handler)
+{
+    uart_init_t params;
+    memset(&params, 0, sizeof(uart_init_t));
+
+    params.evt_handler      = handler;
+    params.baudrate         = NRF_UART_BAUDRATE_115200;
+    params.flow_control     = false;
+    params.rx_buffer_size   = RX_BUFFER_SIZE;
+
+    uart_init_ex(&params);
 }
 
-// Sends the given amount of bytes on the UART.
+void uart_rx_notify_set(uart_rx_notify_t notify)
+{
+    s_rx_notify = notify;
+}
+
+void uart_link_set(nrf_uart_baudrate_t baudrate, bool flow_control)
+{
+    s_link_baudrate     = baudrate;
+    s_link_flow_control = flow_control;
+
+    // Release: the parameters are stored.
+    atomic_store_explicit(&s_link_pending, true, memory_order_release);
+
+    // Applies the switch right away if nothing is being sent.
+    tx_kick();
+}
+
+uint16_t uart_rx_borrow(const uint8_t** data)
+{
+    uint8_t nb_released = atomic_load_explicit(&s_rx_nb_released,
+                                               memory_order_relaxed);
+
+    // Acquire: the buffer size is stored.
+    uint8_t nb_filled   = atomic_load_explicit(&s_rx_nb_filled,
+                                               memory_order_acquire);
+
+    if (nb_released == nb_filled)
+    {
+        // Nothing received.
+        return 0;
+    }
+
+    uint8_t buffer_idx = nb_released % RX_NB_BUFFERS;
+
+    *data = s_rx_buffers[buffer_idx];
+
+    return s_rx_sizes[buffer_idx];
+}
+
+void uart_rx_release(void)
+{
+    uint8_t nb_released = atomic_load_explicit(&s_rx_nb_released,
+                                               memory_order_relaxed);
+    uint8_t nb_filled   = atomic_load_explicit(&s_rx_nb_filled,
+                                               memory_order_acquire);
+
+    if (nb_released == nb_filled)
+    {
+        // Nothing borrowed.
+        return;
+    }
+
+    // Release: the buffer is not accessed anymore.
+    atomic_store_explicit(&s_rx_nb_released, nb_released + 1,
+                          memory_order_release);
+
+    rx_buffers_arm();
+}
+
+uint16_t uart_tx_free_get(void)
+{
+    uint32_t head = atomic_load_explicit(&s_tx_head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&s_tx_tail, memory_order_acquire);
+
+    return TX_RING_SIZE - (head - tail);
+}
+
+/* Copies the given bytes in the sending ring, waiting for room in thread
+** mode. In an interrupt handler, copies as many as possible and returns
+** their amount, or fails with EAGAIN if the ring is full.
+*/
 int _write(int fd, char* str, int len)
 {
-    for (int index = 0; index < len; index++)
+    bool    thread_mode = (current_int_priority_get()
+                           == APP_IRQ_PRIORITY_THREAD);
+    int     index       = 0;
+
+    while (index < len)
     {
-        uint32_t err_code;
-        do
+        uint32_t head       = atomic_load_explicit(&s_tx_head,
+                                                   memory_order_relaxed);
+        uint16_t free_size  = uart_tx_free_get();
+
+        if (free_size == 0)
+        {
+            if (thread_mode)
+            {
+                // The ongoing transfer frees room when done.
+                continue;
+            }
+
+            if (index == 0)
+            {
+                // Back-pressure: the caller shall retry later.
+                errno = EAGAIN;
+                return -1;
+            }
+
+            break;
+        }
+
+        uint16_t written_size = (len - index < free_size) ? len - index
+                                                          : free_size;
+
+        // Copy in two parts if the written bytes wrap around the ring end.
+        uint16_t offset     = head & (TX_RING_SIZE - 1);
+        uint16_t first_size = TX_RING_SIZE - offset;
+        if (first_size > written_size)
         {
-            err_code = app_uart_put(str[index]);
-        } while (err_code != NRF_SUCCESS);
+            first_size = written_size;
+        }
+
+        memcpy(s_tx_ring + offset, str + index, first_size);
+        memcpy(s_tx_ring, str + index + first_size,
+               written_size - first_size);
+
+        // Release: the bytes are copied before being sent.
+        atomic_store_explicit(&s_tx_head, head + written_size,
+                              memory_order_release);
+
+        tx_kick();
+
+        index += written_size;
     }
 
-    return len;
+    return index;
 }
 
 // Reads bytes from the UART until there is no more.
@@ -61,15 +369,272 @@ int _read(int fd, char* str, int len)
 {
     int index = 0;
 
-    uint32_t err_code;
-    do
+    while (index < len)
     {
-        err_code = app_uart_get((uint8_t*)(str + index));
-        if (err_code == NRF_SUCCESS)
+        const uint8_t*  data;
+        uint16_t        size = uart_rx_borrow(&data);
+        if (size == 0)
+        {
+            break;
+        }
+
+        uint16_t copy_size = size - s_rx_read_offset;
+        if (copy_size > len - index)
         {
-            index++;
+            copy_size = len - index;
         }
-    } while (err_code == NRF_SUCCESS && index < len);
+
+        memcpy(str + index, data + s_rx_read_offset, copy_size);
+        index               += copy_size;
+        s_rx_read_offset    += copy_size;
+
+        if (s_rx_read_offset == size)
+        {
+            // Buffer entirely read.
+            s_rx_read_offset = 0;
+            uart_rx_release();
+        }
+    }
 
     return index;
 }
+
+static bool tx_chunk_start(void)
+{
+    uint32_t tail = atomic_load_explicit(&s_tx_tail, memory_order_relaxed);
+
+    // Acquire: the bytes before the head are copied.
+    uint32_t head = atomic_load_explicit(&s_tx_head, memory_order_acquire);
+
+    if (head == tail)
+    {
+        // Nothing to send.
+        return false;
+    }
+
+    // A transfer cannot wrap around the ring end.
+    uint16_t offset         = tail & (TX_RING_SIZE - 1);
+    uint16_t contiguous_size = TX_RING_SIZE - offset;
+    uint32_t chunk_size     = head - tail;
+    if (chunk_size > contiguous_size)
+    {
+        chunk_size = contiguous_size;
+    }
+    if (chunk_size > TX_DMA_MAX_SIZE)
+    {
+        chunk_size = TX_DMA_MAX_SIZE;
+    }
+
+    ret_code_t err_code = nrf_drv_uart_tx(&s_uart, s_tx_ring + offset,
+                                          chunk_size);
+    APP_ERROR_CHECK(err_code);
+
+    return true;
+}
+
+static void tx_kick(void)
+{
+    while (!atomic_exchange(&s_tx_busy, true))
+    {
+        if (tx_chunk_start())
+        {
+            // The transfer end will start the next one.
+            return;
+        }
+
+        link_pending_apply();
+        atomic_store(&s_tx_busy, false);
+
+        /* Bytes may have been written, or a switch requested, before the
+        ** ring was released.
+        */
+        uint32_t head = atomic_load(&s_tx_head);
+        uint32_t tail = atomic_load(&s_tx_tail);
+        if ((head == tail) && !atomic_load(&s_link_pending))
+        {
+            return;
+        }
+    }
+}
+
+static void link_pending_apply(void)
+{
+    // Acquire: the parameters are stored.
+    if (!atomic_exchange_explicit(&s_link_pending, false,
+                                  memory_order_acquire))
+    {
+        // No switch requested.
+        return;
+    }
+
+    // Same conversion as the driver, which is given UART parameters.
+    nrf_uarte_baudrate_set(s_uart.uarte.p_reg,
+                           (nrf_uarte_baudrate_t)s_link_baudrate);
+    nrf_uarte_configure(s_uart.uarte.p_reg, NRF_UARTE_PARITY_EXCLUDED,
+                        s_link_flow_control ? NRF_UARTE_HWFC_ENABLED
+                                            : NRF_UARTE_HWFC_DISABLED);
+}
+
+static void rx_buffers_arm(void)
+{
+    CRITICAL_REGION_ENTER();
+
+    uint8_t nb_released = atomic_load_explicit(&s_rx_nb_released,
+                                               memory_order_acquire);
+
+    while ((uint8_t)(s_rx_nb_armed - nb_released) < RX_NB_BUFFERS)
+    {
+        uint8_t* buffer = s_rx_buffers[s_rx_nb_armed % RX_NB_BUFFERS];
+
+        ret_code_t err_code = nrf_drv_uart_rx(&s_uart, buffer,
+                                              s_rx_buffer_size);
+        if (err_code == NRF_ERROR_BUSY)
+        {
+            // Driver already has a current and a next buffer.
+            break;
+        }
+        APP_ERROR_CHECK(err_code);
+
+        s_rx_nb_armed++;
+    }
+
+    CRITICAL_REGION_EXIT();
+}
+
+static void rx_on_done(uint16_t nb_bytes)
+{
+    uint8_t nb_filled = atomic_load_explicit(&s_rx_nb_filled,
+                                             memory_order_relaxed);
+
+    if (nb_bytes > 0)
+    {
+        s_rx_sizes[nb_filled % RX_NB_BUFFERS] = nb_bytes;
+        nb_filled++;
+
+        // Release: the buffer size is stored.
+        atomic_store_explicit(&s_rx_nb_filled, nb_filled,
+                              memory_order_release);
+    }
+
+    if (nb_bytes < s_rx_buffer_size)
+    {
+        /* Reception was stopped: the driver dropped the next buffer, and
+        ** the current one if it is empty.
+        */
+        CRITICAL_REGION_ENTER();
+        s_rx_nb_armed = nb_filled;
+        CRITICAL_REGION_EXIT();
+    }
+
+    rx_buffers_arm();
+}
+
+static void app_evt_send(app_uart_evt_t* event)
+{
+    if (s_evt_handler != NULL)
+    {
+        s_evt_handler(event);
+    }
+}
+
+static void uart_evt_handler(nrf_drv_uart_event_t* event, void* context)
+{
+    app_uart_evt_t app_event;
+    memset(&app_event, 0, sizeof(app_uart_evt_t));
+
+    switch (event->type)
+    {
+    case NRF_DRV_UART_EVT_TX_DONE:
+    {
+        uint32_t tail = atomic_load_explicit(&s_tx_tail,
+                                             memory_order_relaxed);
+
+        // Release: the sent bytes are not accessed anymore.
+        atomic_store_explicit(&s_tx_tail, tail + event->data.rxtx.bytes,
+                              memory_order_release);
+
+        if (tx_chunk_start())
+        {
+            break;
+        }
+
+        link_pending_apply();
+        atomic_store(&s_tx_busy, false);
+        tx_kick();
+
+        if (!atomic_load(&s_tx_busy))
+        {
+            app_event.evt_type = APP_UART_TX_EMPTY;
+            app_evt_send(&app_event);
+        }
+    }
+        break;
+    case NRF_DRV_UART_EVT_RX_DONE:
+        rx_on_done(event->data.rxtx.bytes);
+
+        if (event->data.rxtx.bytes > 0)
+        {
+            app_event.evt_type = APP_UART_DATA_READY;
+            app_evt_send(&app_event);
+
+            if (s_rx_notify != NULL)
+            {
+                s_rx_notify();
+            }
+        }
+        break;
+    case NRF_DRV_UART_EVT_ERROR:
+        // Received bytes are discarded, since they may be corrupted.
+        rx_on_done(0);
+
+        app_event.evt_type                  = APP_UART_COMMUNICATION_ERROR;
+        app_event.data.error_communication  = event->data.error.error_mask;
+        app_evt_send(&app_event);
+        break;
+    default:
+        break;
+    }
+}
+
+static void rx_pin_handler(nrf_drv_gpiote_pin_t pin,
+                           nrf_gpiote_polarity_t action)
+{
+    // The idle timer watches the line until the bytes are handed over.
+    nrf_drv_gpiote_in_event_disable(RX_PIN_NUMBER);
+
+    nrf_uarte_event_clear(s_uart.uarte.p_reg, NRF_UARTE_EVENT_RXDRDY);
+
+    ret_code_t err_code = app_timer_start(s_rx_idle_timer,
+                                          APP_TIMER_TICKS(RX_IDLE_TIMEOUT_MS),
+                                          NULL);
+    APP_ERROR_CHECK(err_code);
+}
+
+static void rx_idle_timer_handler(void* context)
+{
+    NRF_UARTE_Type* uarte = s_uart.uarte.p_reg;
+
+    if (!nrf_uarte_event_check(uarte, NRF_UARTE_EVENT_RXDRDY))
+    {
+        // Line became idle: hand the received bytes to the application.
+        nrf_drv_uart_rx_abort(&s_uart);
+
+        nrf_drv_gpiote_in_event_enable(RX_PIN_NUMBER, true);
+
+        if (!nrf_uarte_event_check(uarte, NRF_UARTE_EVENT_RXDRDY))
+        {
+            return;
+        }
+
+        // A byte ended before the pin was watched again.
+        nrf_drv_gpiote_in_event_disable(RX_PIN_NUMBER);
+    }
+
+    // Bytes were received since the timer was started.
+    nrf_uarte_event_clear(uarte, NRF_UARTE_EVENT_RXDRDY);
+
+    ret_code_t err_code = app_timer_start(s_rx_idle_timer,
+                                          APP_TIMER_TICKS(RX_IDLE_TIMEOUT_MS),
+                                          NULL);
+    APP_ERROR_CHECK(err_code);
+}
@@ -1,16 +1,104 @@
 #ifndef UART_HELPERS_H
 #define UART_HELPERS_H
 
+// C STANDARD
+#include <stdbool.h>    // bool
+#include <stdint.h>     // uint16_t
+
+// NRF
+#include "nrf_uart.h"   // nrf_uart_baudrate_t
+
 // NRF APPS
 #include "app_uart.h"   // app_uart_event_handler_t
 
-// Sending and reception buffers sizes.
-#define RX_FIFO_SIZE    256
-#define TX_FIFO_SIZE    256
+// Maximum size of each of the two reception buffers filled by EasyDMA.
+#define RX_BUFFER_SIZE      128
+
+/* Idle time after which a partially filled reception buffer is handed
+** to the application.
+*/
+#define RX_IDLE_TIMEOUT_MS  2
+
+// Sending ring size. Shall be a power of two.
+#define TX_RING_SIZE        512
+
+/* Function called by the interrupt handler each time received data is
+** handed to the application.
+*/
+typedef void (*uart_rx_notify_t)(void);
+
+// Parameters of the UART channel.
+typedef struct
+{
+    // Event callback function.
+    app_uart_event_handler_t    evt_handler;
+
+    // Initial baudrate.
+    nrf_uart_baudrate_t         baudrate;
 
-/* Initializes the UART channel with predefined parameters and an event
-** callback function.
+    /* True to enable RTS/CTS hardware flow control. The RTS/CTS pins are
+    ** connected either way, so that it can be enabled later.
+    */
+    bool                        flow_control;
+
+    /* Size of each reception buffer, at most RX_BUFFER_SIZE. Smaller
+    ** buffers are handed to the application more often.
+    */
+    uint16_t                    rx_buffer_size;
+} uart_init_t;
+
+/* Initializes the UART channel with the given parameters. The app_timer
+** module shall be initialized. The RX pin is watched with a GPIOTE port
+** event, so that the idle timer only runs while bytes are received.
+**
+** Data written with `_write` is copied in the sending ring and sent in
+** the background using EasyDMA: `_write` shall only be called from one
+** context. In thread mode, it waits for room in the ring until all the
+** data is copied. In an interrupt handler, where waiting could stall
+** the transfer, it copies what fits and fails with EAGAIN if nothing
+** does.
+**
+** Data is received by EasyDMA in two alternating buffers, handed to the
+** application (APP_UART_DATA_READY event) when full or when the line
+** has been idle for RX_IDLE_TIMEOUT_MS. It can be consumed either with
+** `_read` or with the borrow/release functions below, from one context,
+** but the two methods shall not be mixed.
+*/
+void uart_init_ex(const uart_init_t* parameters);
+
+/* Initializes the UART channel with the given event callback function,
+** at 115200 baud without flow control and with full-size reception
+** buffers, as `uart_init_ex` does.
 */
 void uart_init(const app_uart_event_handler_t handler);
 
+/* Sets the function called after the event handler each time received
+** data is handed to the application, e.g. to wake a run loop up. Can be
+** called before the initialization, by a module not owning the channel.
+*/
+void uart_rx_notify_set(uart_rx_notify_t notify);
+
+/* Switches the UART channel to the given baudrate and flow control once
+** every byte written so far has been sent, so that an acknowledgement
+** written just before is still sent with the current parameters. The
+** remote end shall switch once it has received the acknowledgement.
+*/
+void uart_link_set(nrf_uart_baudrate_t baudrate, bool flow_control);
+
+/* Sets `data` to the oldest received data and returns its size, or
+** returns 0 if there is none. The data stays valid, and is returned by
+** every call, until it is released.
+*/
+uint16_t uart_rx_borrow(const uint8_t** data);
+
+/* Releases the data returned by `uart_rx_borrow`, so that its buffer can
+** receive again.
+*/
+void uart_rx_release(void);
+
+/* Returns the number of bytes which can currently be written without
+** being truncated.
+*/
+uint16_t uart_tx_free_get(void);
+
 #endif /* ! UART_HELPERS_H */
@@ -0,0 +1,210 @@
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+#include <stdio.h>          // printf
+#include <string.h>         // memset
+#include <unistd.h>         // read
+
+// NRF
+#include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "nrf_uart.h"       // NRF_UART_BAUDRATE_115200
+#include "sdk_errors.h"     // ret_code_t
+
+// NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // app_timer_init
+#include "app_uart.h"       // app_uart_*
+
+// LUOS
+#include "luos_hal_board.h" // LuosHAL_BoardInit
+
+// CUSTOM
+#include "frag.h"           // FRAG_RX_DEF, frag_*
+#include "msg_queue.h"      // MSG_QUEUE_DEF, msg_queue_*, tx_buffer_t
+#include "uart_helpers.h"   // uart_init_ex, uart_init_t, RX_BUFFER_SIZE
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Maximum size of a fragment, header included.
+#define FRAGMENT_SIZE       8
+
+// Maximum size of a line.
+#define LINE_SIZE           RX_BUFFER_SIZE
+
+// Fragments queue, able to hold the fragments of a whole line.
+MSG_QUEUE_DEF(s_fragments,
+              LINE_SIZE / (FRAGMENT_SIZE - FRAG_HEADER_SIZE) + 1,
+              FRAGMENT_SIZE);
+
+// Fragmentation instance.
+static frag_tx_t        s_frag_tx           = { 0 };
+
+// Reassembly instance.
+FRAG_RX_DEF(s_frag_rx, LINE_SIZE);
+
+// Line being received.
+static uint8_t          s_line[LINE_SIZE]   = { 0 };
+
+// Size of the line being received.
+static uint16_t         s_line_size         = 0;
+
+// Stop char
+static const char       STOP_CHAR           = '\r';
+
+// Line prefixes making the second fragment lost or duplicated.
+static const char       LOSE_CHAR           = '-';
+static const char       DUPLICATE_CHAR      = '+';
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Reads the received characters until a line is complete, then sends it
+** through the fragments queue. Returns false if there was nothing to
+** read.
+*/
+static bool manage_received_data(void);
+
+/* Fragments the given line, then reassembles it from the queue, losing
+** or duplicating its second fragment according to its first character.
+** Prints the reassembled line and the reception statistics.
+*/
+static void line_loopback(const uint8_t* line, uint16_t size);
+
+/*      CALLBACKS                                                   */
+
+/* Data ready:  Calls the data management function until there is
+**              nothing left to read.
+** TX empty:    Does nothing.
+** UART data:   Not supposed to happen.
+** FIFO error:  Logs error.
+** Com error:   Logs error.
+*/
+static void uart_cb(app_uart_evt_t* event);
+
+int main(void)
+{
+    LuosHAL_BoardInit();
+
+    // Needed for UART idle line detection.
+    ret_code_t err_code = app_timer_init();
+    APP_ERROR_CHECK(err_code);
+
+    uart_init_t uart_params;
+    memset(&uart_params, 0, sizeof(uart_init_t));
+
+    uart_params.evt_handler     = uart_cb;
+    uart_params.baudrate        = NRF_UART_BAUDRATE_115200;
+    uart_params.flow_control    = false;
+    uart_params.rx_buffer_size  = RX_BUFFER_SIZE;
+
+    uart_init_ex(&uart_params);
+
+    err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps between the events, handled by the callbacks.
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
+}
+
+static bool manage_received_data(void)
+{
+    ssize_t read_bytes = read(0, s_line + s_line_size, 1);
+    if (read_bytes <= 0)
+    {
+        return false;
+    }
+
+    s_line_size++;
+
+    bool complete = (s_line[s_line_size - 1] == STOP_CHAR);
+    if (!complete && (s_line_size < LINE_SIZE))
+    {
+        // Line is incomplete.
+        return true;
+    }
+
+    line_loopback(s_line, complete ? s_line_size - 1 : s_line_size);
+    s_line_size = 0;
+
+    return true;
+}
+
+static void line_loopback(const uint8_t* line, uint16_t size)
+{
+    bool sent = frag_send(&s_frag_tx, &s_fragments, line, size,
+                          FRAGMENT_SIZE);
+    if (!sent)
+    {
+        NRF_LOG_INFO("Fragments queue full!");
+    }
+
+    uint16_t    fragment_idx    = 0;
+    uint16_t    frame_size      = 0;
+
+    const tx_buffer_t* fragment;
+    while ((fragment = msg_queue_inst_peek(&s_fragments)) != NULL)
+    {
+        bool lose       = (fragment_idx == 1) && (line[0] == LOSE_CHAR);
+        bool duplicate  = (fragment_idx == 1)
+                          && (line[0] == DUPLICATE_CHAR);
+
+        uint8_t nb_receptions = lose ? 0 : (duplicate ? 2 : 1);
+        for (uint8_t reception = 0; reception < nb_receptions; reception++)
+        {
+            uint16_t size = frag_receive(&s_frag_rx, fragment->buffer,
+                                         fragment->size);
+            if (size > 0)
+            {
+                frame_size = size;
+            }
+        }
+
+        msg_queue_inst_pop(&s_fragments);
+        fragment_idx++;
+    }
+
+    if (frame_size > 0)
+    {
+        printf("Reassembled: \"%.*s\" (%u fragments)!\r\n", frame_size,
+               (char*)(s_frag_rx.buffer), fragment_idx);
+    }
+    else
+    {
+        printf("Line dropped (%u fragments)!\r\n", fragment_idx);
+    }
+
+    const frag_stats_t* stats = &(s_frag_rx.stats);
+
+    printf("Frames: %lu, lost: %lu, duplicates: %lu, overflows: %lu!\r\n",
+           stats->frame_count, stats->lost_count, stats->duplicate_count,
+           stats->overflow_count);
+}
+
+static void uart_cb(app_uart_evt_t* event)
+{
+    switch(event->evt_type)
+    {
+    case APP_UART_DATA_READY:
+        while (manage_received_data());
+        break;
+    case APP_UART_TX_EMPTY:
+        break;
+    case APP_UART_DATA:
+        NRF_LOG_INFO("Non-FIFO data received (\?\?\?)");
+        break;
+    case APP_UART_FIFO_ERROR:
+        NRF_LOG_INFO("Fifo error!");
+        break;
+    case APP_UART_COMMUNICATION_ERROR:
+        NRF_LOG_INFO("Communication error!");
+        break;
+    default:
+        NRF_LOG_INFO("Unknown type!");
+        break;
+    }
+}
@@ -0,0 +1,146 @@
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+#include <string.h>         // memset
+#include <unistd.h>         // write
+
+// NRF
+#include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "nrf_uart.h"       // NRF_UART_BAUDRATE_115200
+#include "sdk_errors.h"     // ret_code_t
+
+// NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // app_timer_init
+#include "app_uart.h"       // app_uart_*
+
+// LUOS
+#include "luos_hal_board.h" // LuosHAL_BoardInit
+
+// CUSTOM
+#include "frame.h"          /* FRAME_DECODER_DEF, FRAME_ENCODED_SIZE_MAX,
+                            ** frame_*
+                            */
+#include "uart_helpers.h"   /* uart_init_ex, uart_init_t, uart_rx_*,
+                            ** RX_BUFFER_SIZE
+                            */
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Maximum size of a received message.
+#define MSG_MAX_SIZE    64
+
+// Frame decoder instance.
+FRAME_DECODER_DEF(s_frame_decoder, MSG_MAX_SIZE);
+
+// Buffer in which echoed messages are encoded.
+static uint8_t s_frame_buffer[FRAME_ENCODED_SIZE_MAX(MSG_MAX_SIZE)];
+
+/*      STATIC FUNCTIONS                                            */
+
+// Logs the given received message, and sends it back in a frame.
+static void msg_echo(const uint8_t* msg, uint16_t size);
+
+/*      CALLBACKS                                                   */
+
+/* Data ready:  Decodes the received frames and echoes their messages.
+** TX empty:    Does nothing.
+** UART data:   Not supposed to happen.
+** FIFO error:  Logs error.
+** Com error:   Logs error.
+*/
+static void uart_cb(app_uart_evt_t* event);
+
+int main(void)
+{
+    LuosHAL_BoardInit();
+
+    // Needed for UART idle line detection.
+    ret_code_t err_code = app_timer_init();
+    APP_ERROR_CHECK(err_code);
+
+    uart_init_t uart_params;
+    memset(&uart_params, 0, sizeof(uart_init_t));
+
+    uart_params.evt_handler     = uart_cb;
+    uart_params.baudrate        = NRF_UART_BAUDRATE_115200;
+    uart_params.flow_control    = false;
+    uart_params.rx_buffer_size  = RX_BUFFER_SIZE;
+
+    uart_init_ex(&uart_params);
+
+    err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps between the events, handled by the callbacks.
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
+}
+
+static void msg_echo(const uint8_t* msg, uint16_t size)
+{
+    NRF_LOG_INFO("Received message of %u bytes!", size);
+
+    uint16_t frame_size = frame_encode(msg, size, s_frame_buffer,
+                                       sizeof(s_frame_buffer));
+
+    ssize_t written_bytes = write(1, s_frame_buffer, frame_size);
+    if (written_bytes != frame_size)
+    {
+        NRF_LOG_INFO("Echo truncated!");
+    }
+}
+
+static void uart_cb(app_uart_evt_t* event)
+{
+    switch(event->evt_type)
+    {
+    case APP_UART_DATA_READY:
+    {
+        const uint8_t*  data;
+        uint16_t        size;
+        while ((size = uart_rx_borrow(&data)) > 0)
+        {
+            uint16_t offset = 0;
+            while (offset < size)
+            {
+                uint16_t msg_size;
+                offset += frame_decode(&s_frame_decoder, data + offset,
+                                       size - offset, &msg_size);
+
+                if (msg_size > 0)
+                {
+                    msg_echo(s_frame_decoder.buffer, msg_size);
+                }
+            }
+
+            uart_rx_release();
+        }
+
+        NRF_LOG_INFO("Frames: %lu, errors: %lu, overflows: %lu!",
+                     s_frame_decoder.stats.frame_count,
+                     s_frame_decoder.stats.error_count,
+                     s_frame_decoder.stats.overflow_count);
+    }
+        break;
+    case APP_UART_TX_EMPTY:
+        break;
+    case APP_UART_DATA:
+        NRF_LOG_INFO("Non-FIFO data received (\?\?\?)");
+        break;
+    case APP_UART_FIFO_ERROR:
+        NRF_LOG_INFO("Fifo error!");
+        break;
+    case APP_UART_COMMUNICATION_ERROR:
+        NRF_LOG_INFO("Communication error!");
+        break;
+    default:
+        NRF_LOG_INFO("Unknown type!");
+        break;
+    }
+}
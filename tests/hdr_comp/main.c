@@ -0,0 +1,295 @@
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+#include <stdio.h>          // printf
+#include <string.h>         // memcmp, memset
+#include <unistd.h>         // read
+
+// NRF
+#include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "nrf_uart.h"       // NRF_UART_BAUDRATE_115200
+#include "sdk_errors.h"     // ret_code_t
+
+// NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // app_timer_init
+#include "app_uart.h"       // app_uart_*
+
+// LUOS
+#include "luos_hal_board.h" // LuosHAL_BoardInit
+
+// CUSTOM
+#include "hdr_comp.h"       // hdr_comp_*, HDR_COMP_MAX_SIZE
+#include "uart_helpers.h"   // uart_init_ex, uart_init_t, RX_BUFFER_SIZE
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+/* Size of a Robus header: protocol (4 bits), target (12 bits), target
+** mode (4 bits), source (12 bits), command (8 bits) and size (16 bits).
+*/
+#define HEADER_SIZE         7
+
+// Flow key: every field but the size.
+#define KEY_SIZE            5
+
+// Maximum number of simulated containers, besides the Gate one.
+#define MAX_CONTAINERS      8
+
+// Number of replayed messages.
+#define NB_MESSAGES         1000
+
+// One message out of this period is a broadcast.
+#define BROADCAST_PERIOD    16
+
+// Robus addressing, as seen on the link.
+#define GATE_ID             1
+#define BROADCAST_ID        0x0FFF
+#define MODE_ID             0x0
+#define MODE_BROADCAST      0x3
+
+// Commands of the replayed traffic.
+#define CMD_ASK_PUB         0x0B
+#define CMD_NODE_UUID       0x06
+static const uint8_t    DATA_CMDS[]     = { 0x20, 0x2A, 0x31, 0x45 };
+
+// Data sizes of the answers, per command.
+static const uint8_t    DATA_SIZES[]    = { 1, 4, 3, 8 };
+
+// Compression of the sender and decompression of the receiver.
+static hdr_comp_t       s_encoder;
+static hdr_comp_t       s_decoder;
+
+// Pseudo-random generator state, for the broadcasts.
+static uint32_t         s_random        = 1;
+
+// Line being received.
+static char             s_line[RX_BUFFER_SIZE + 1]  = { 0 };
+
+// Size of the line being received.
+static uint16_t         s_line_size     = 0;
+
+// Stop char
+static const char       STOP_CHAR       = '\r';
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Reads the received characters until a line is complete, then replays
+** the traffic of the number of containers it holds, or of every number
+** of containers if there is none. Returns false if there was nothing to
+** read.
+*/
+static bool manage_received_data(void);
+
+/* Replays the traffic of a Gate polling the given number of containers
+** over a compressed link, and prints the bytes sent per message with and
+** without compression.
+*/
+static void traffic_replay(uint8_t nb_containers);
+
+// Builds the header of the given message.
+static void header_pack(uint8_t* header, uint16_t target, uint8_t mode,
+                        uint16_t source, uint8_t cmd, uint16_t size);
+
+// Returns the next pseudo-random number.
+static uint32_t random_next(void);
+
+/*      CALLBACKS                                                   */
+
+/* Data ready:  Calls the data management function until there is
+**              nothing left to read.
+** TX empty:    Does nothing.
+** UART data:   Not supposed to happen.
+** FIFO error:  Logs error.
+** Com error:   Logs error.
+*/
+static void uart_cb(app_uart_evt_t* event);
+
+int main(void)
+{
+    LuosHAL_BoardInit();
+
+    // Needed for UART idle line detection.
+    ret_code_t err_code = app_timer_init();
+    APP_ERROR_CHECK(err_code);
+
+    uart_init_t uart_params;
+    memset(&uart_params, 0, sizeof(uart_init_t));
+
+    uart_params.evt_handler     = uart_cb;
+    uart_params.baudrate        = NRF_UART_BAUDRATE_115200;
+    uart_params.flow_control    = false;
+    uart_params.rx_buffer_size  = RX_BUFFER_SIZE;
+
+    uart_init_ex(&uart_params);
+
+    err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps between the events, handled by the callbacks.
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
+}
+
+static bool manage_received_data(void)
+{
+    ssize_t read_bytes = read(0, s_line + s_line_size, 1);
+    if (read_bytes <= 0)
+    {
+        return false;
+    }
+
+    s_line_size++;
+
+    bool complete = (s_line[s_line_size - 1] == STOP_CHAR);
+    if (!complete && (s_line_size < RX_BUFFER_SIZE))
+    {
+        // Line is incomplete.
+        return true;
+    }
+
+    uint8_t nb_containers = 0;
+    if ((s_line[0] >= '1') && (s_line[0] <= '0' + MAX_CONTAINERS))
+    {
+        nb_containers = s_line[0] - '0';
+    }
+
+    s_line_size = 0;
+
+    if (nb_containers > 0)
+    {
+        traffic_replay(nb_containers);
+        return true;
+    }
+
+    for (nb_containers = 1; nb_containers <= MAX_CONTAINERS;
+         nb_containers++)
+    {
+        traffic_replay(nb_containers);
+    }
+
+    return true;
+}
+
+static void traffic_replay(uint8_t nb_containers)
+{
+    hdr_comp_init(&s_encoder, HEADER_SIZE, KEY_SIZE);
+    hdr_comp_init(&s_decoder, HEADER_SIZE, KEY_SIZE);
+    s_random = 1;
+
+    uint8_t     header[HEADER_SIZE];
+    uint8_t     decoded[HEADER_SIZE];
+    uint8_t     compressed[HDR_COMP_MAX_SIZE];
+
+    uint32_t    data_bytes      = 0;
+    uint32_t    mismatch_count  = 0;
+
+    for (uint32_t msg_idx = 0; msg_idx < NB_MESSAGES; msg_idx++)
+    {
+        // The Gate asks each container in turn, which answers.
+        uint8_t     container   = (msg_idx / 2) % nb_containers;
+        uint16_t    id          = GATE_ID + 1 + container;
+        uint8_t     type        = container % sizeof(DATA_CMDS);
+        uint16_t    size        = 0;
+
+        if (msg_idx % BROADCAST_PERIOD == BROADCAST_PERIOD - 1)
+        {
+            size = 1 + random_next() % 16;
+            header_pack(header, BROADCAST_ID, MODE_BROADCAST, id,
+                        CMD_NODE_UUID, size);
+        }
+        else if (msg_idx % 2 == 0)
+        {
+            header_pack(header, id, MODE_ID, GATE_ID, CMD_ASK_PUB, size);
+        }
+        else
+        {
+            size = DATA_SIZES[type];
+            header_pack(header, GATE_ID, MODE_ID, id, DATA_CMDS[type],
+                        size);
+        }
+
+        data_bytes += size;
+
+        uint8_t comp_size = hdr_comp_encode(&s_encoder, header, compressed);
+
+        uint8_t read_size = hdr_comp_decode(&s_decoder, compressed,
+                                            comp_size, decoded);
+        if ((read_size != comp_size)
+            || (memcmp(header, decoded, HEADER_SIZE) != 0))
+        {
+            mismatch_count++;
+        }
+    }
+
+    const hdr_comp_stats_t* stats = &(s_encoder.stats);
+
+    uint32_t raw_avg    = stats->raw_bytes * 100 / NB_MESSAGES;
+    uint32_t comp_avg   = stats->comp_bytes * 100 / NB_MESSAGES;
+    uint32_t before_avg = (stats->raw_bytes + data_bytes) * 100
+                          / NB_MESSAGES;
+    uint32_t after_avg  = (stats->comp_bytes + data_bytes) * 100
+                          / NB_MESSAGES;
+
+    printf("%u containers: %u messages!\r\n", nb_containers, NB_MESSAGES);
+    printf("  Header: %lu.%02lu -> %lu.%02lu bytes/message "
+           "(full %lu, delta %lu, hit %lu)!\r\n", raw_avg / 100,
+           raw_avg % 100, comp_avg / 100, comp_avg % 100,
+           stats->full_count, stats->delta_count, stats->hit_count);
+    printf("  On air: %lu.%02lu -> %lu.%02lu bytes/message!\r\n",
+           before_avg / 100, before_avg % 100, after_avg / 100,
+           after_avg % 100);
+    printf("  Decoding errors: %lu, mismatches: %lu!\r\n",
+           s_decoder.stats.error_count, mismatch_count);
+}
+
+static void header_pack(uint8_t* header, uint16_t target, uint8_t mode,
+                        uint16_t source, uint8_t cmd, uint16_t size)
+{
+    // Robus protocol version 0, fields packed from the LSB.
+    uint64_t bits = ((uint64_t)(target & 0x0FFF) << 4)
+                    | ((uint64_t)(mode & 0x0F) << 16)
+                    | ((uint64_t)(source & 0x0FFF) << 20)
+                    | ((uint64_t)cmd << 32)
+                    | ((uint64_t)size << 40);
+
+    for (uint8_t byte_idx = 0; byte_idx < HEADER_SIZE; byte_idx++)
+    {
+        header[byte_idx] = (uint8_t)(bits >> (8 * byte_idx));
+    }
+}
+
+static uint32_t random_next(void)
+{
+    s_random = s_random * 1103515245 + 12345;
+
+    return (s_random >> 16);
+}
+
+static void uart_cb(app_uart_evt_t* event)
+{
+    switch(event->evt_type)
+    {
+    case APP_UART_DATA_READY:
+        while (manage_received_data());
+        break;
+    case APP_UART_TX_EMPTY:
+        break;
+    case APP_UART_DATA:
+        NRF_LOG_INFO("Non-FIFO data received (\?\?\?)");
+        break;
+    case APP_UART_FIFO_ERROR:
+        NRF_LOG_INFO("Fifo error!");
+        break;
+    case APP_UART_COMMUNICATION_ERROR:
+        NRF_LOG_INFO("Communication error!");
+        break;
+    default:
+        NRF_LOG_INFO("Unknown type!");
+        break;
+    }
+}
@@ -0,0 +1,192 @@
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <errno.h>          // errno, EAGAIN
+#include <stdatomic.h>      // atomic_bool, atomic_*
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+#include <string.h>         // memset
+#include <unistd.h>         // read, write
+
+// NRF
+#include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "nrf_uart.h"       // NRF_UART_BAUDRATE_115200
+#include "sdk_errors.h"     // ret_code_t
+
+// NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // app_timer_init
+#include "app_uart.h"       // app_uart_*
+
+// LUOS
+#include "luos_hal_board.h" // LuosHAL_BoardInit
+
+// CUSTOM
+#include "json_writer.h"    // JSON_WRITER_DEF, json_writer_*
+#include "uart_helpers.h"   // uart_init_ex, uart_init_t, RX_BUFFER_SIZE
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Size of the buffer staging the JSON output.
+#define JSON_BUFFER_SIZE    32
+
+// Number of containers in the printed routing table.
+#define NB_CONTAINERS       3
+
+/* Sends the given staged output through UART, waiting for room in the
+** sending ring. Shall not be called from the UART interrupt.
+*/
+static bool uart_flush(const uint8_t* data, uint16_t size);
+
+// JSON writer instance.
+JSON_WRITER_DEF(s_json_writer, JSON_BUFFER_SIZE, uart_flush);
+
+// Set when a document shall be printed.
+static atomic_bool  s_print_requested   = false;
+
+// Number of printed documents, used to vary the printed values.
+static uint32_t     s_nb_printed        = 0;
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Prints a document shaped like the Gate routing table and container
+** states, then logs whether it could be sent.
+*/
+static void document_print(void);
+
+/*      CALLBACKS                                                   */
+
+/* Data ready:  Discards the received data, and requests a document.
+** TX empty:    Does nothing.
+** UART data:   Not supposed to happen.
+** FIFO error:  Logs error.
+** Com error:   Logs error.
+*/
+static void uart_cb(app_uart_evt_t* event);
+
+int main(void)
+{
+    LuosHAL_BoardInit();
+
+    // Needed for UART idle line detection.
+    ret_code_t err_code = app_timer_init();
+    APP_ERROR_CHECK(err_code);
+
+    uart_init_t uart_params;
+    memset(&uart_params, 0, sizeof(uart_init_t));
+
+    uart_params.evt_handler     = uart_cb;
+    uart_params.baudrate        = NRF_UART_BAUDRATE_115200;
+    uart_params.flow_control    = false;
+    uart_params.rx_buffer_size  = RX_BUFFER_SIZE;
+
+    uart_init_ex(&uart_params);
+
+    err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps until a print is requested.
+    while (true)
+    {
+        if (atomic_exchange(&s_print_requested, false))
+        {
+            document_print();
+        }
+
+        nrf_pwr_mgmt_run();
+    }
+}
+
+static bool uart_flush(const uint8_t* data, uint16_t size)
+{
+    while (size > 0)
+    {
+        ssize_t written_bytes = write(1, data, size);
+        if (written_bytes == -1)
+        {
+            if (errno != EAGAIN)
+            {
+                return false;
+            }
+
+            // Sending ring full: wait for the ongoing transfer.
+            continue;
+        }
+
+        data += written_bytes;
+        size -= written_bytes;
+    }
+
+    return true;
+}
+
+static void document_print(void)
+{
+    static const char* const TYPES[NB_CONTAINERS] =
+    {
+        "Gate", "State", "State",
+    };
+    static const char* const ALIASES[NB_CONTAINERS] =
+    {
+        "gate", "led_toggler", "led_toggler1",
+    };
+
+    json_writer_t* writer = &s_json_writer;
+
+    json_writer_object_begin(writer, NULL);
+    json_writer_array_begin(writer, "routing_table");
+
+    for (uint8_t container_idx = 0; container_idx < NB_CONTAINERS;
+         container_idx++)
+    {
+        json_writer_object_begin(writer, NULL);
+        json_writer_string(writer, "type", TYPES[container_idx]);
+        json_writer_int(writer, "id", container_idx + 1);
+        json_writer_string(writer, "alias", ALIASES[container_idx]);
+        json_writer_bool(writer, "state",
+                         (s_nb_printed + container_idx) % 2 == 0);
+        json_writer_number(writer, "rate", s_nb_printed / 10.0);
+        json_writer_object_end(writer);
+    }
+
+    json_writer_array_end(writer);
+    json_writer_object_end(writer);
+
+    bool success = json_writer_end(writer);
+    uart_flush((const uint8_t*)"\r\n", 2);
+
+    s_nb_printed++;
+
+    NRF_LOG_INFO("Document %lu %s!", s_nb_printed,
+                 success ? "sent" : "truncated");
+}
+
+static void uart_cb(app_uart_evt_t* event)
+{
+    switch(event->evt_type)
+    {
+    case APP_UART_DATA_READY:
+    {
+        uint8_t received[RX_BUFFER_SIZE];
+        while (read(0, received, sizeof(received)) > 0);
+
+        atomic_store(&s_print_requested, true);
+    }
+        break;
+    case APP_UART_TX_EMPTY:
+        break;
+    case APP_UART_DATA:
+        NRF_LOG_INFO("Non-FIFO data received (\?\?\?)");
+        break;
+    case APP_UART_FIFO_ERROR:
+        NRF_LOG_INFO("Fifo error!");
+        break;
+    case APP_UART_COMMUNICATION_ERROR:
+        NRF_LOG_INFO("Communication error!");
+        break;
+    default:
+        NRF_LOG_INFO("Unknown type!");
+        break;
+    }
+}
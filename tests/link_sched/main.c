@@ -0,0 +1,285 @@
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+#include <stdio.h>          // printf
+#include <string.h>         // memcpy, memset
+#include <unistd.h>         // read
+
+// NRF
+#include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "nrf_uart.h"       // NRF_UART_BAUDRATE_115200
+#include "sdk_errors.h"     // ret_code_t
+
+// NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // app_timer_init
+#include "app_uart.h"       // app_uart_*
+
+// LUOS
+#include "luos_hal_board.h" // LuosHAL_BoardInit
+
+// CUSTOM
+#include "link_sched.h"     // LINK_SCHED_DEF, link_sched_*
+#include "uart_helpers.h"   // uart_init_ex, uart_init_t, RX_BUFFER_SIZE
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Maximum number of simulated links.
+#define MAX_LINKS           8
+
+// Number of messages each link queue can hold.
+#define QUEUE_DEPTH         8
+
+// Size of a simulated message, starting with its production event.
+#define MSG_SIZE            20
+
+// Number of simulated connection events.
+#define NB_EVENTS           1000
+
+// Messages a link can take per connection event.
+#define LINK_CAPACITY       2
+
+// Messages the radio can send per connection event, over all links.
+#define RADIO_CAPACITY      6
+
+/* When there are several links, the first one is a slow node: it takes a
+** single message every few connection events, less than it is sent.
+*/
+#define SLOW_LINK_PERIOD    4
+
+/* Sends the given message on the given simulated link, if it has not
+** used its capacity for the current event yet.
+*/
+static bool sim_send(uint16_t conn_handle, const uint8_t* data,
+                     uint16_t size);
+
+// Link scheduler instance.
+LINK_SCHED_DEF(s_sched, MAX_LINKS, QUEUE_DEPTH, MSG_SIZE, sim_send);
+
+// Simulation state and results of a link.
+typedef struct
+{
+    // Messages the link can still take during the current event.
+    uint8_t     budget;
+
+    // Number of messages which could not be enqueued.
+    uint32_t    drop_count;
+
+    // Sum and maximum of the delivery latencies, in events.
+    uint32_t    latency_sum;
+    uint32_t    latency_max;
+} sim_link_t;
+
+// Simulated links.
+static sim_link_t   s_sim_links[MAX_LINKS];
+
+// Current connection event.
+static uint32_t     s_event             = 0;
+
+// Line being received.
+static char         s_line[RX_BUFFER_SIZE + 1]  = { 0 };
+
+// Size of the line being received.
+static uint16_t     s_line_size         = 0;
+
+// Stop char
+static const char   STOP_CHAR           = '\r';
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Reads the received characters until a line is complete, then runs the
+** simulation for the number of links it holds, or for every number of
+** links if there is none. Returns false if there was nothing to read.
+*/
+static bool manage_received_data(void);
+
+/* Simulates the given number of links, each sent one message per
+** connection event, and prints the aggregate throughput and per-link
+** latencies.
+*/
+static void simulation_run(uint8_t nb_links);
+
+/*      CALLBACKS                                                   */
+
+/* Data ready:  Calls the data management function until there is
+**              nothing left to read.
+** TX empty:    Does nothing.
+** UART data:   Not supposed to happen.
+** FIFO error:  Logs error.
+** Com error:   Logs error.
+*/
+static void uart_cb(app_uart_evt_t* event);
+
+int main(void)
+{
+    LuosHAL_BoardInit();
+
+    // Needed for UART idle line detection.
+    ret_code_t err_code = app_timer_init();
+    APP_ERROR_CHECK(err_code);
+
+    uart_init_t uart_params;
+    memset(&uart_params, 0, sizeof(uart_init_t));
+
+    uart_params.evt_handler     = uart_cb;
+    uart_params.baudrate        = NRF_UART_BAUDRATE_115200;
+    uart_params.flow_control    = false;
+    uart_params.rx_buffer_size  = RX_BUFFER_SIZE;
+
+    uart_init_ex(&uart_params);
+
+    err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps between the events, handled by the callbacks.
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
+}
+
+static bool sim_send(uint16_t conn_handle, const uint8_t* data,
+                     uint16_t size)
+{
+    sim_link_t* link = &(s_sim_links[conn_handle]);
+    if (link->budget == 0)
+    {
+        return false;
+    }
+
+    link->budget--;
+
+    uint32_t produced_event;
+    memcpy(&produced_event, data, sizeof(produced_event));
+
+    uint32_t latency = s_event - produced_event;
+
+    link->latency_sum += latency;
+    if (latency > link->latency_max)
+    {
+        link->latency_max = latency;
+    }
+
+    return true;
+}
+
+static bool manage_received_data(void)
+{
+    ssize_t read_bytes = read(0, s_line + s_line_size, 1);
+    if (read_bytes <= 0)
+    {
+        return false;
+    }
+
+    s_line_size++;
+
+    bool complete = (s_line[s_line_size - 1] == STOP_CHAR);
+    if (!complete && (s_line_size < RX_BUFFER_SIZE))
+    {
+        // Line is incomplete.
+        return true;
+    }
+
+    uint8_t nb_links = 0;
+    if ((s_line[0] >= '1') && (s_line[0] <= '0' + MAX_LINKS))
+    {
+        nb_links = s_line[0] - '0';
+    }
+
+    s_line_size = 0;
+
+    if (nb_links > 0)
+    {
+        simulation_run(nb_links);
+        return true;
+    }
+
+    for (nb_links = 1; nb_links <= MAX_LINKS; nb_links++)
+    {
+        simulation_run(nb_links);
+    }
+
+    return true;
+}
+
+static void simulation_run(uint8_t nb_links)
+{
+    link_sched_init(&s_sched);
+    memset(s_sim_links, 0, sizeof(s_sim_links));
+
+    for (uint8_t link_idx = 0; link_idx < nb_links; link_idx++)
+    {
+        // Connection handles are the simulated link indexes.
+        link_sched_link_add(&s_sched, link_idx);
+    }
+
+    uint8_t msg[MSG_SIZE] = { 0 };
+    uint32_t nb_sent = 0;
+
+    for (s_event = 0; s_event < NB_EVENTS; s_event++)
+    {
+        memcpy(msg, &s_event, sizeof(s_event));
+
+        for (uint8_t link_idx = 0; link_idx < nb_links; link_idx++)
+        {
+            sim_link_t* link = &(s_sim_links[link_idx]);
+
+            if (!link_sched_enqueue(&s_sched, link_idx, msg, MSG_SIZE))
+            {
+                link->drop_count++;
+            }
+
+            bool slow       = (link_idx == 0) && (nb_links > 1);
+            link->budget    = slow ? (s_event % SLOW_LINK_PERIOD == 0)
+                                   : LINK_CAPACITY;
+        }
+
+        nb_sent += link_sched_run(&s_sched, RADIO_CAPACITY);
+    }
+
+    printf("%u links: %lu messages/100 events!\r\n", nb_links,
+           nb_sent * 100 / NB_EVENTS);
+
+    for (uint8_t link_idx = 0; link_idx < nb_links; link_idx++)
+    {
+        const sim_link_t*           link    = &(s_sim_links[link_idx]);
+        const link_sched_stats_t*   stats   = &(s_sched.links[link_idx]
+                                                .stats);
+
+        uint32_t latency_avg = (stats->sent_count > 0)
+                               ? link->latency_sum * 100 / stats->sent_count
+                               : 0;
+
+        printf("  Link %u: sent %lu, dropped %lu, latency avg %lu.%02lu "
+               "max %lu events!\r\n", link_idx, stats->sent_count,
+               link->drop_count, latency_avg / 100, latency_avg % 100,
+               link->latency_max);
+    }
+}
+
+static void uart_cb(app_uart_evt_t* event)
+{
+    switch(event->evt_type)
+    {
+    case APP_UART_DATA_READY:
+        while (manage_received_data());
+        break;
+    case APP_UART_TX_EMPTY:
+        break;
+    case APP_UART_DATA:
+        NRF_LOG_INFO("Non-FIFO data received (\?\?\?)");
+        break;
+    case APP_UART_FIFO_ERROR:
+        NRF_LOG_INFO("Fifo error!");
+        break;
+    case APP_UART_COMMUNICATION_ERROR:
+        NRF_LOG_INFO("Communication error!");
+        break;
+    default:
+        NRF_LOG_INFO("Unknown type!");
+        break;
+    }
+}
@@ -0,0 +1,446 @@
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+#include <stdio.h>          // printf
+#include <string.h>         // memset
+#include <unistd.h>         // read
+
+// NRF
+#include "nrf.h"            // DWT, CoreDebug
+#include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "nrf_uart.h"       // NRF_UART_BAUDRATE_115200
+#include "sdk_errors.h"     // ret_code_t
+
+// NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // app_timer_init
+#include "app_uart.h"       // app_uart_*
+
+// LUOS
+#include "luos_hal_board.h" // LuosHAL_BoardInit
+
+// CUSTOM
+#include "msg_pool.h"       // MSG_POOL_DEF, msg_pool_*
+#include "uart_helpers.h"   // uart_init_ex, uart_init_t, RX_BUFFER_SIZE
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Number of replayed ticks.
+#define NB_TICKS            4000
+
+/* The reception produces a burst of messages every period, three
+** quarters of what the link can take when it does not stall.
+*/
+#define BURST_PERIOD        8
+#define BURST_SIZE          6
+
+// The link stalls for a number of ticks out of this period.
+#define STALL_PERIOD        64
+#define STALL_STEP          4
+#define MAX_STALL_LEVEL     8
+
+// Maximum number of messages waiting for the link.
+#define MAX_PENDING         256
+
+/* Message sizes of a captured Gate polling cycle: 7-byte headers with
+** their data, ASK_PUB requests, answers, node UUIDs and a few large
+** routing table parts.
+*/
+static const uint16_t   TRACE_SIZES[]   = { 7, 8, 7, 11, 7, 10, 7, 15,
+                                            7, 8, 23, 7, 11, 71, 7, 135 };
+
+// Size of the storage of each allocator, in bytes.
+#define STORAGE_SIZE        1824
+
+static uint32_t clock_get(void);
+
+// Pool under test: same storage size as the ring.
+MSG_POOL_CLASS_DEF(s_small, 16, 44);
+MSG_POOL_CLASS_DEF(s_medium, 32, 9);
+MSG_POOL_CLASS_DEF(s_large, 136, 6);
+MSG_POOL_DEF(s_pool, clock_get, &s_small, &s_medium, &s_large);
+
+/* Reference ring allocator: messages stored back to back in one buffer,
+** and freed in order, as a shared reception/transmission buffer.
+*/
+static uint8_t          s_ring[STORAGE_SIZE];
+static uint16_t         s_ring_head     = 0;
+static uint16_t         s_ring_tail     = 0;
+static uint16_t         s_ring_count    = 0;
+
+// Message waiting for the link.
+typedef struct
+{
+    // Message buffer.
+    uint8_t*    data;
+
+    // Size of the message.
+    uint16_t    size;
+} pending_msg_t;
+
+// Messages waiting for the link, in order.
+static pending_msg_t    s_pending[MAX_PENDING];
+static uint16_t         s_pending_first = 0;
+static uint16_t         s_pending_count = 0;
+
+// Latencies of an allocator, in CPU cycles.
+typedef struct
+{
+    uint32_t    alloc_sum;
+    uint32_t    alloc_max;
+    uint32_t    alloc_count;
+    uint32_t    free_sum;
+    uint32_t    free_max;
+    uint32_t    free_count;
+} latency_t;
+
+// Current tick.
+static uint32_t         s_tick          = 0;
+
+// Pseudo-random generator state, for the trace.
+static uint32_t         s_random        = 1;
+
+// Line being received.
+static char             s_line[RX_BUFFER_SIZE + 1]  = { 0 };
+
+// Size of the line being received.
+static uint16_t         s_line_size     = 0;
+
+// Stop char
+static const char       STOP_CHAR       = '\r';
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Reads the received characters until a line is complete, then replays
+** the trace with the link stall level it holds, or with every level if
+** there is none. Returns false if there was nothing to read.
+*/
+static bool manage_received_data(void);
+
+/* Replays the trace with both allocators, the link stalling for
+** `stall_level` * STALL_STEP ticks out of STALL_PERIOD, and prints their
+** drop rates and latencies.
+*/
+static void trace_replay(uint8_t stall_level);
+
+/* Replays the trace with the pool, or with the ring if `ring` is set.
+** Fills the given latencies and returns the number of dropped messages.
+*/
+static uint32_t allocator_run(bool ring, uint8_t stall_level,
+                              latency_t* latency);
+
+/* Allocates a message of the given size in the ring. Returns NULL if it
+** does not fit.
+*/
+static uint8_t* ring_alloc(uint16_t size);
+
+// Frees the given message of the given size, the oldest of the ring.
+static void ring_free(const uint8_t* data, uint16_t size);
+
+// Prints the given latencies.
+static void latency_print(const char* name, uint32_t drop_count,
+                          uint32_t nb_messages, const latency_t* latency);
+
+// Adds a measure to the given sum and maximum.
+static void latency_add(uint32_t* sum, uint32_t* max, uint32_t cycles);
+
+// Returns the next pseudo-random number.
+static uint32_t random_next(void);
+
+/*      CALLBACKS                                                   */
+
+/* Data ready:  Calls the data management function until there is
+**              nothing left to read.
+** TX empty:    Does nothing.
+** UART data:   Not supposed to happen.
+** FIFO error:  Logs error.
+** Com error:   Logs error.
+*/
+static void uart_cb(app_uart_evt_t* event);
+
+int main(void)
+{
+    LuosHAL_BoardInit();
+
+    // Needed for UART idle line detection.
+    ret_code_t err_code = app_timer_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Cycle counter, for the latencies.
+    CoreDebug->DEMCR    |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT         = 0;
+    DWT->CTRL           |= DWT_CTRL_CYCCNTENA_Msk;
+
+    uart_init_t uart_params;
+    memset(&uart_params, 0, sizeof(uart_init_t));
+
+    uart_params.evt_handler     = uart_cb;
+    uart_params.baudrate        = NRF_UART_BAUDRATE_115200;
+    uart_params.flow_control    = false;
+    uart_params.rx_buffer_size  = RX_BUFFER_SIZE;
+
+    uart_init_ex(&uart_params);
+
+    err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps between the events, handled by the callbacks.
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
+}
+
+static uint32_t clock_get(void)
+{
+    return s_tick;
+}
+
+static bool manage_received_data(void)
+{
+    ssize_t read_bytes = read(0, s_line + s_line_size, 1);
+    if (read_bytes <= 0)
+    {
+        return false;
+    }
+
+    s_line_size++;
+
+    bool complete = (s_line[s_line_size - 1] == STOP_CHAR);
+    if (!complete && (s_line_size < RX_BUFFER_SIZE))
+    {
+        // Line is incomplete.
+        return true;
+    }
+
+    bool    all_levels  = true;
+    uint8_t stall_level = 0;
+    if ((s_line[0] >= '0') && (s_line[0] <= '0' + MAX_STALL_LEVEL))
+    {
+        all_levels  = false;
+        stall_level = s_line[0] - '0';
+    }
+
+    s_line_size = 0;
+
+    if (!all_levels)
+    {
+        trace_replay(stall_level);
+        return true;
+    }
+
+    for (stall_level = 0; stall_level <= MAX_STALL_LEVEL; stall_level++)
+    {
+        trace_replay(stall_level);
+    }
+
+    return true;
+}
+
+static void trace_replay(uint8_t stall_level)
+{
+    uint32_t    nb_messages = NB_TICKS / BURST_PERIOD * BURST_SIZE;
+    latency_t   latency;
+
+    printf("Link stalled %u/%u ticks: %lu messages!\r\n",
+           stall_level * STALL_STEP, STALL_PERIOD, nb_messages);
+
+    uint32_t drop_count = allocator_run(false, stall_level, &latency);
+    latency_print("Pool", drop_count, nb_messages, &latency);
+
+    for (uint8_t class_idx = 0; class_idx < s_pool.nb_classes; class_idx++)
+    {
+        const msg_pool_class_t*         cls     = s_pool.classes[class_idx];
+        const msg_pool_class_stats_t*   stats   = &(cls->stats);
+
+        printf("    %u-byte class: high water %u/%u, failures %lu, "
+               "spills %lu, lifetime avg %lu ticks!\r\n", cls->block_size,
+               stats->high_water, cls->nb_blocks, stats->fail_count,
+               stats->spill_count, msg_pool_lifetime_avg(cls));
+    }
+
+    drop_count = allocator_run(true, stall_level, &latency);
+    latency_print("Ring", drop_count, nb_messages, &latency);
+}
+
+static uint32_t allocator_run(bool ring, uint8_t stall_level,
+                              latency_t* latency)
+{
+    msg_pool_init(&s_pool);
+    s_ring_head     = 0;
+    s_ring_tail     = 0;
+    s_ring_count    = 0;
+
+    s_pending_first = 0;
+    s_pending_count = 0;
+    s_random        = 1;
+    memset(latency, 0, sizeof(latency_t));
+
+    uint32_t drop_count = 0;
+
+    for (s_tick = 0; s_tick < NB_TICKS; s_tick++)
+    {
+        for (uint8_t msg_idx = 0;
+             (s_tick % BURST_PERIOD == 0) && (msg_idx < BURST_SIZE);
+             msg_idx++)
+        {
+            uint16_t size = TRACE_SIZES[random_next()
+                                        % (sizeof(TRACE_SIZES)
+                                           / sizeof(TRACE_SIZES[0]))];
+
+            uint32_t start  = DWT->CYCCNT;
+            uint8_t* data   = ring ? ring_alloc(size)
+                                   : msg_pool_alloc(&s_pool, size);
+            latency_add(&(latency->alloc_sum), &(latency->alloc_max),
+                        DWT->CYCCNT - start);
+            latency->alloc_count++;
+
+            if ((data == NULL) || (s_pending_count == MAX_PENDING))
+            {
+                drop_count++;
+                continue;
+            }
+
+            pending_msg_t* msg = &(s_pending[(s_pending_first
+                                              + s_pending_count)
+                                             % MAX_PENDING]);
+            msg->data = data;
+            msg->size = size;
+            s_pending_count++;
+        }
+
+        bool stalled = (s_tick % STALL_PERIOD < stall_level * STALL_STEP);
+        if (stalled || (s_pending_count == 0))
+        {
+            continue;
+        }
+
+        // The link sends the oldest message.
+        const pending_msg_t* msg = &(s_pending[s_pending_first]);
+
+        uint32_t start = DWT->CYCCNT;
+        if (ring)
+        {
+            ring_free(msg->data, msg->size);
+        }
+        else
+        {
+            msg_pool_free(&s_pool, msg->data);
+        }
+        latency_add(&(latency->free_sum), &(latency->free_max),
+                    DWT->CYCCNT - start);
+        latency->free_count++;
+
+        s_pending_first = (s_pending_first + 1) % MAX_PENDING;
+        s_pending_count--;
+    }
+
+    return drop_count;
+}
+
+static uint8_t* ring_alloc(uint16_t size)
+{
+    size = MSG_POOL_BLOCK_SIZE(size);
+
+    if (s_ring_count == 0)
+    {
+        s_ring_head = 0;
+        s_ring_tail = 0;
+    }
+
+    uint16_t offset = 0;
+
+    if ((s_ring_count == 0) || (s_ring_head > s_ring_tail))
+    {
+        if (STORAGE_SIZE - s_ring_head >= size)
+        {
+            offset = s_ring_head;
+        }
+        else if (s_ring_tail >= size)
+        {
+            // Wrap, losing the end of the buffer.
+            offset = 0;
+        }
+        else
+        {
+            return NULL;
+        }
+    }
+    else if (s_ring_tail - s_ring_head >= size)
+    {
+        offset = s_ring_head;
+    }
+    else
+    {
+        return NULL;
+    }
+
+    s_ring_head = offset + size;
+    s_ring_count++;
+
+    return s_ring + offset;
+}
+
+static void ring_free(const uint8_t* data, uint16_t size)
+{
+    s_ring_tail = (data - s_ring) + MSG_POOL_BLOCK_SIZE(size);
+    s_ring_count--;
+}
+
+static void latency_print(const char* name, uint32_t drop_count,
+                          uint32_t nb_messages, const latency_t* latency)
+{
+    uint32_t drop_rate  = drop_count * 10000 / nb_messages;
+    uint32_t alloc_avg  = (latency->alloc_count > 0)
+                          ? latency->alloc_sum / latency->alloc_count : 0;
+    uint32_t free_avg   = (latency->free_count > 0)
+                          ? latency->free_sum / latency->free_count : 0;
+
+    printf("  %s: dropped %lu (%lu.%02lu%%), alloc avg %lu max %lu "
+           "cycles, free avg %lu max %lu cycles!\r\n", name, drop_count,
+           drop_rate / 100, drop_rate % 100, alloc_avg, latency->alloc_max,
+           free_avg, latency->free_max);
+}
+
+static void latency_add(uint32_t* sum, uint32_t* max, uint32_t cycles)
+{
+    *sum += cycles;
+    if (cycles > *max)
+    {
+        *max = cycles;
+    }
+}
+
+static uint32_t random_next(void)
+{
+    s_random = s_random * 1103515245 + 12345;
+
+    return (s_random >> 16);
+}
+
+static void uart_cb(app_uart_evt_t* event)
+{
+    switch(event->evt_type)
+    {
+    case APP_UART_DATA_READY:
+        while (manage_received_data());
+        break;
+    case APP_UART_TX_EMPTY:
+        break;
+    case APP_UART_DATA:
+        NRF_LOG_INFO("Non-FIFO data received (\?\?\?)");
+        break;
+    case APP_UART_FIFO_ERROR:
+        NRF_LOG_INFO("Fifo error!");
+        break;
+    case APP_UART_COMMUNICATION_ERROR:
+        NRF_LOG_INFO("Communication error!");
+        break;
+    default:
+        NRF_LOG_INFO("Unknown type!");
+        break;
+    }
+}
@@ -2,24 +2,38 @@
 
 // C STANDARD
 #include <stdbool.h>        // bool
-#include <string.h>         // strncmp
+#include <stdio.h>          // printf
+#include <string.h>         // memcmp, memset, strncmp
 #include <unistd.h>         // read
 
 // NRF
 #include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "nrf_uart.h"       // NRF_UART_BAUDRATE_115200
+#include "sdk_errors.h"     // ret_code_t
 
 // NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // app_timer_init
 #include "app_uart.h"       // app_uart_*
 
 // LUOS
 #include "luos_hal_board.h" // LuosHAL_BoardInit
 
 // CUSTOM
-#include "msg_queue.h"      // msg_queue_*, TX_BUF_SIZE, tx_buffer_t
-#include "uart_helpers.h"   // uart_init
+#include "msg_queue.h"      /* MSG_QUEUE_DEF, msg_queue_*, TX_BUF_SIZE,
+                            ** tx_buffer_t
+                            */
+#include "uart_helpers.h"   // uart_init_ex, uart_init_t, RX_BUFFER_SIZE
 
 /*      STATIC VARIABLES & CONSTANTS                                */
 
+// Number of messages the queue can hold.
+#define                 MSG_QUEUE_DEPTH                     8
+
+// Message queue instance.
+MSG_QUEUE_DEF(s_msg_queue, MSG_QUEUE_DEPTH, TX_BUF_SIZE);
+
 // Internal buffer
 static uint8_t          s_internal_buffer[TX_BUF_SIZE + 1]  = { 0 };
 
@@ -33,16 +47,80 @@ static const char       STOP_CHAR                           = '\r';
 #define                 DEQUEUE_STRING                      "dequeue"
 static const uint16_t   DEQUEUE_STRING_SIZE                 = sizeof(DEQUEUE_STRING) - 1;
 
+// Flush string
+#define                 FLUSH_STRING                        "flush"
+static const uint16_t   FLUSH_STRING_SIZE                   = sizeof(FLUSH_STRING) - 1;
+
+// Statistics string
+#define                 STATS_STRING                        "stats"
+static const uint16_t   STATS_STRING_SIZE                   = sizeof(STATS_STRING) - 1;
+
+// Check string
+#define                 CHECK_STRING                        "check"
+static const uint16_t   CHECK_STRING_SIZE                   = sizeof(CHECK_STRING) - 1;
+
+// Queue exercised by the checks, left empty by each of them.
+MSG_QUEUE_DEF(s_check_queue, MSG_QUEUE_DEPTH, TX_BUF_SIZE);
+
+// Low priority lane of the lanes checks, the queue above being the first.
+MSG_QUEUE_DEF(s_check_low_queue, MSG_QUEUE_DEPTH, TX_BUF_SIZE);
+
+// Lanes served by priority.
+MSG_QUEUE_LANES_DEF(s_check_strict, MSG_QUEUE_LANES_STRICT,
+                    { &s_check_queue, 1 }, { &s_check_low_queue, 1 });
+
+// Lanes served in turn, the first one twice as much as the second one.
+MSG_QUEUE_LANES_DEF(s_check_weighted, MSG_QUEUE_LANES_WEIGHTED,
+                    { &s_check_queue, 2 }, { &s_check_low_queue, 1 });
+
+// Lanes served by the weighted lanes check while both are not empty.
+static const uint8_t    CHECK_WEIGHTED_ORDER[]  = { 0, 0, 1, 0, 0, 1, 1, 1 };
+
+// Number of messages enqueued in each lane by the lanes checks.
+#define                 CHECK_LANE_SIZE                     4
+
+// Size of the small messages stored by the checks.
+#define                 CHECK_SMALL_SIZE                    8
+
+// Number of messages stored by the checks going around the ring.
+#define                 CHECK_NB_MESSAGES                   100
+
+// Number of messages held in the queue while going around the ring.
+#define                 CHECK_LAG                           3
+
+// Number of messages enqueued at once by the batch check.
+#define                 CHECK_BATCH_SIZE                    5
+
+// Number of messages popped at once by the batch check.
+#define                 CHECK_BATCH_POP                     2
+
+// Check of the queue functions, returning true on success.
+typedef bool (*check_fn_t)(void);
+
+// Check, and the name printed with its result.
+typedef struct
+{
+    const char* name;
+    check_fn_t  fn;
+} check_t;
+
 /*      STATIC FUNCTIONS                                            */
 
 /* If the received message is complete (stop char received):
 ** -    If the received message corresponds to the dequeue word, logs
 **      the last word in the queue and pops it.
+** -    If the received message corresponds to the flush word, logs all
+**      the words in the queue and pops them at once.
+** -    If the received message corresponds to the stats word, prints
+**      the queue statistics.
+** -    If the received message corresponds to the check word, runs the
+**      checks of the queue functions and prints their results.
 ** -    If the queue is full, logs the last word in the queue and pops
 **      it, then enqueues the received word.
 ** -    Else, enqueues the received word.
+** Returns false if there was nothing to read.
 */
-static void manage_received_data(void);
+static bool manage_received_data(void);
 
 // Enqueues the given amount of bytes from the internal buffer.
 static bool enqueue_internal_buffer(uint16_t nb_chars);
@@ -50,9 +128,79 @@ static bool enqueue_internal_buffer(uint16_t nb_chars);
 // Pops the last message from the queue and prints it.
 static bool dequeue_print(void);
 
+// Pops all the messages from the queue at once and prints them.
+static void flush_print(void);
+
+// Prints the high-water mark and overflow count of the queue.
+static void stats_print(void);
+
+// Runs the checks of the queue functions and prints their results.
+static void checks_run(void);
+
+/* Messages are stored at their own size: more than MSG_QUEUE_DEPTH small
+** ones fit, a message bigger than a slot does not, and messages of
+** varying sizes going around the ring are read back unchanged.
+*/
+static bool check_records(void);
+
+/* A reserved area is only visible once committed, at the committed size,
+** and reserving in a full queue fails and counts an overflow.
+*/
+static bool check_reserve_commit(void);
+
+/* Messages enqueued at once are all visible, peeked at once in order,
+** and popped at once from the oldest.
+*/
+static bool check_batch(void);
+
+/* With the strict policy, the second lane is only served once the first
+** one is empty.
+*/
+static bool check_lanes_strict(void);
+
+/* With the weighted policy, the lanes are served in turn as many times in
+** a row as their weight, then the lane left alone is served.
+*/
+static bool check_lanes_weighted(void);
+
+/* Messages enqueued with `msg_queue_enqueue` go to the lane chosen by the
+** selection function, and the control lane is served first.
+*/
+static bool check_lanes_default(void);
+
+/* Enqueues CHECK_LANE_SIZE messages in each lane of the given multi-lane
+** queue, the lane index as content, then pops all of them. Fills `order`
+** with the lane of each popped message, and returns false if a message
+** could not be enqueued or if a lane is not left empty.
+*/
+static bool check_lanes_serve(msg_queue_lanes_t* lanes, uint8_t* order);
+
+// Fills the given buffer with the content of the message of given index.
+static void check_message_fill(uint8_t* data, uint16_t msg_idx,
+                               uint16_t size);
+
+// Returns the size of the message of the given index.
+static uint16_t check_message_size(uint16_t msg_idx);
+
+// Checks of the queue functions.
+static const check_t CHECKS[] =
+{
+    { "Variable-size records",  check_records },
+    { "Reserve/commit",         check_reserve_commit },
+    { "Batch",                  check_batch },
+    { "Strict lanes",           check_lanes_strict },
+    { "Weighted lanes",         check_lanes_weighted },
+    { "Default lanes",          check_lanes_default },
+};
+
 /*      CALLBACKS                                                   */
 
-/* Data ready:  Calls the data management function.
+// Returns the lane given by the first byte of the message.
+static msg_queue_lane_idx_t check_lane_select(const uint8_t* data,
+                                              uint16_t size);
+
+/* Data ready:  Calls the data management function until there is
+**              nothing left to read.
 ** TX empty:    Not supposed to happen.
 ** UART data:   Not supposed to happen.
 ** FIFO error:  Logs error.
@@ -64,12 +212,31 @@ int main(void)
 {
     LuosHAL_BoardInit();
 
-    uart_init(uart_cb);
+    // Needed for UART idle line detection.
+    ret_code_t err_code = app_timer_init();
+    APP_ERROR_CHECK(err_code);
+
+    uart_init_t uart_params;
+    memset(&uart_params, 0, sizeof(uart_init_t));
+
+    uart_params.evt_handler     = uart_cb;
+    uart_params.baudrate        = NRF_UART_BAUDRATE_115200;
+    uart_params.flow_control    = false;
+    uart_params.rx_buffer_size  = RX_BUFFER_SIZE;
+
+    uart_init_ex(&uart_params);
 
-    while (true);
+    err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps between the events, handled by the callbacks.
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
 }
 
-static void manage_received_data(void)
+static bool manage_received_data(void)
 {
     ssize_t read_bytes = read(0, s_internal_buffer + s_internal_index,
                               TX_BUF_SIZE - s_internal_index);
@@ -80,7 +247,7 @@ static void manage_received_data(void)
             NRF_LOG_INFO("Read error!");
         }
 
-        return;
+        return false;
     }
 
     s_internal_index += read_bytes;
@@ -93,7 +260,7 @@ static void manage_received_data(void)
         NRF_LOG_INFO("Message incomplete! (current buffer: %s)",
                      (char*)s_internal_buffer);
 
-        return;
+        return true;
     }
 
     s_internal_index = 0;
@@ -116,7 +283,34 @@ static void manage_received_data(void)
         if (cmp_res == 0)
         {
             dequeue_print();
-            return;
+            return true;
+        }
+
+        cmp_res = strncmp((char*)s_internal_buffer, FLUSH_STRING,
+                          FLUSH_STRING_SIZE);
+
+        if (cmp_res == 0)
+        {
+            flush_print();
+            return true;
+        }
+
+        cmp_res = strncmp((char*)s_internal_buffer, STATS_STRING,
+                          STATS_STRING_SIZE);
+
+        if (cmp_res == 0)
+        {
+            stats_print();
+            return true;
+        }
+
+        cmp_res = strncmp((char*)s_internal_buffer, CHECK_STRING,
+                          CHECK_STRING_SIZE);
+
+        if (cmp_res == 0)
+        {
+            checks_run();
+            return true;
         }
 
         sent_size = last_index;
@@ -128,7 +322,7 @@ static void manage_received_data(void)
     if (enqueue_success)
     {
         // Nothing left to do.
-        return;
+        return true;
     }
 
     NRF_LOG_INFO("Enqueue failed!");
@@ -137,7 +331,7 @@ static void manage_received_data(void)
     if (!dequeue_success)
     {
         NRF_LOG_INFO("Both enqueue and dequeue failed! (\?\?\?)");
-        return;
+        return true;
     }
 
     // Once a message was popped, another one can fit in.
@@ -145,14 +339,16 @@ static void manage_received_data(void)
     if (!enqueue_success)
     {
         NRF_LOG_INFO("Enqueue failed after pop! (\?\?\?)");
-        return;
+        return true;
     }
+
+    return true;
 }
 
 static bool enqueue_internal_buffer(uint16_t nb_chars)
 {
-    bool enqueue_success = msg_queue_enqueue(s_internal_buffer,
-                                             nb_chars);
+    bool enqueue_success = msg_queue_inst_enqueue(&s_msg_queue,
+                                                  s_internal_buffer, nb_chars);
 
     if (enqueue_success)
     {
@@ -168,27 +364,314 @@ static bool enqueue_internal_buffer(uint16_t nb_chars)
 
 static bool dequeue_print(void)
 {
-    const tx_buffer_t* queue_head = msg_queue_peek();
+    const tx_buffer_t* queue_head = msg_queue_inst_peek(&s_msg_queue);
     if (queue_head == NULL)
     {
         NRF_LOG_INFO("Message queue empty!");
         return false;
     }
 
-    printf("Dequeued message: \"%s\" (size: %u)!\r\n",
-           (char*)(queue_head->buffer), queue_head->size);
+    printf("Dequeued message: \"%.*s\" (size: %u)!\r\n",
+           queue_head->size, (char*)(queue_head->buffer),
+           queue_head->size);
 
-    msg_queue_pop();
+    msg_queue_inst_pop(&s_msg_queue);
 
     return true;
 }
 
+static void flush_print(void)
+{
+    tx_buffer_t queue_tail[MSG_QUEUE_DEPTH];
+    uint16_t nb_peeked = msg_queue_inst_peek_n(&s_msg_queue, queue_tail,
+                                               MSG_QUEUE_DEPTH);
+
+    for (uint16_t msg_idx = 0; msg_idx < nb_peeked; msg_idx++)
+    {
+        printf("Flushed message: \"%.*s\" (size: %u)!\r\n",
+               queue_tail[msg_idx].size,
+               (char*)(queue_tail[msg_idx].buffer),
+               queue_tail[msg_idx].size);
+    }
+
+    msg_queue_inst_pop_n(&s_msg_queue, nb_peeked);
+}
+
+static void stats_print(void)
+{
+    const msg_queue_stats_t* stats = &(s_msg_queue.stats);
+
+    printf("High-water mark: %u/%u, overflows: %lu!\r\n",
+           stats->high_water_mark, MSG_QUEUE_DEPTH,
+           stats->overflow_count);
+}
+
+static void checks_run(void)
+{
+    uint8_t nb_checks = sizeof(CHECKS) / sizeof(CHECKS[0]);
+
+    for (uint8_t check_idx = 0; check_idx < nb_checks; check_idx++)
+    {
+        bool success = CHECKS[check_idx].fn();
+
+        printf("%s: %s!\r\n", CHECKS[check_idx].name,
+               success ? "OK" : "FAILED");
+    }
+}
+
+static bool check_records(void)
+{
+    uint8_t data[TX_BUF_SIZE + 1];
+    bool    success = true;
+
+    memset(data, 0, sizeof(data));
+
+    uint16_t nb_enqueued = 0;
+    while (msg_queue_inst_enqueue(&s_check_queue, data, CHECK_SMALL_SIZE))
+    {
+        nb_enqueued++;
+    }
+
+    success &= (nb_enqueued > MSG_QUEUE_DEPTH);
+    success &= (msg_queue_inst_count(&s_check_queue) == nb_enqueued);
+
+    msg_queue_inst_pop_n(&s_check_queue, nb_enqueued);
+
+    success &= !msg_queue_inst_enqueue(&s_check_queue, data, TX_BUF_SIZE + 1);
+
+    // Messages are popped CHECK_LAG messages after being enqueued.
+    for (uint16_t msg_idx = 0; msg_idx < CHECK_NB_MESSAGES + CHECK_LAG;
+         msg_idx++)
+    {
+        if (msg_idx < CHECK_NB_MESSAGES)
+        {
+            uint16_t size = check_message_size(msg_idx);
+
+            check_message_fill(data, msg_idx, size);
+            success &= msg_queue_inst_enqueue(&s_check_queue, data, size);
+        }
+
+        if (msg_idx < CHECK_LAG)
+        {
+            continue;
+        }
+
+        uint16_t popped_idx = msg_idx - CHECK_LAG;
+        uint16_t size       = check_message_size(popped_idx);
+
+        check_message_fill(data, popped_idx, size);
+
+        const tx_buffer_t* queue_head = msg_queue_inst_peek(&s_check_queue);
+        success &= (queue_head != NULL) && (queue_head->size == size)
+                   && (memcmp(queue_head->buffer, data, size) == 0);
+
+        msg_queue_inst_pop(&s_check_queue);
+    }
+
+    success &= (msg_queue_inst_peek(&s_check_queue) == NULL);
+
+    return success;
+}
+
+static bool check_reserve_commit(void)
+{
+    bool success = true;
+
+    uint8_t* area = msg_queue_inst_reserve(&s_check_queue, TX_BUF_SIZE);
+    if (area == NULL)
+    {
+        return false;
+    }
+
+    check_message_fill(area, 0, CHECK_SMALL_SIZE);
+    success &= (msg_queue_inst_peek(&s_check_queue) == NULL);
+
+    msg_queue_inst_commit(&s_check_queue, CHECK_SMALL_SIZE);
+
+    const tx_buffer_t* queue_head = msg_queue_inst_peek(&s_check_queue);
+    success &= (queue_head != NULL)
+               && (queue_head->buffer == area)
+               && (queue_head->size == CHECK_SMALL_SIZE);
+
+    // Full queue: the next reservation fails.
+    uint16_t nb_committed = 1;
+    while ((area = msg_queue_inst_reserve(&s_check_queue, TX_BUF_SIZE)) != NULL)
+    {
+        msg_queue_inst_commit(&s_check_queue, TX_BUF_SIZE);
+        nb_committed++;
+    }
+
+    uint32_t overflow_count = s_check_queue.stats.overflow_count;
+
+    success &= (nb_committed >= MSG_QUEUE_DEPTH);
+    success &= (msg_queue_inst_reserve(&s_check_queue, TX_BUF_SIZE) == NULL);
+    success &= (s_check_queue.stats.overflow_count == overflow_count + 1);
+
+    msg_queue_inst_pop_n(&s_check_queue, nb_committed);
+    success &= (msg_queue_inst_peek(&s_check_queue) == NULL);
+
+    return success;
+}
+
+static bool check_batch(void)
+{
+    // Kept off the stack of the UART interrupt handler.
+    static uint8_t  data[CHECK_BATCH_SIZE][TX_BUF_SIZE];
+
+    tx_buffer_t     buffers[CHECK_BATCH_SIZE];
+    tx_buffer_t     views[MSG_QUEUE_DEPTH];
+    bool            success = true;
+
+    for (uint16_t msg_idx = 0; msg_idx < CHECK_BATCH_SIZE; msg_idx++)
+    {
+        buffers[msg_idx].buffer = data[msg_idx];
+        buffers[msg_idx].size   = check_message_size(msg_idx);
+
+        check_message_fill(data[msg_idx], msg_idx, buffers[msg_idx].size);
+    }
+
+    success &= (msg_queue_inst_enqueue_n(&s_check_queue, buffers,
+                                         CHECK_BATCH_SIZE) == CHECK_BATCH_SIZE);
+    success &= (msg_queue_inst_count(&s_check_queue) == CHECK_BATCH_SIZE);
+
+    uint16_t nb_peeked = msg_queue_inst_peek_n(&s_check_queue, views,
+                                               MSG_QUEUE_DEPTH);
+    success &= (nb_peeked == CHECK_BATCH_SIZE);
+
+    for (uint16_t msg_idx = 0; msg_idx < nb_peeked; msg_idx++)
+    {
+        success &= (views[msg_idx].size == buffers[msg_idx].size)
+                   && (memcmp(views[msg_idx].buffer, data[msg_idx],
+                              views[msg_idx].size) == 0);
+    }
+
+    msg_queue_inst_pop_n(&s_check_queue, CHECK_BATCH_POP);
+    success &= (msg_queue_inst_count(&s_check_queue)
+                == CHECK_BATCH_SIZE - CHECK_BATCH_POP);
+
+    // The oldest message left is the first one not popped.
+    nb_peeked = msg_queue_inst_peek_n(&s_check_queue, views, 1);
+    success &= (nb_peeked == 1)
+               && (views[0].size == buffers[CHECK_BATCH_POP].size)
+               && (memcmp(views[0].buffer, data[CHECK_BATCH_POP],
+                          views[0].size) == 0);
+
+    msg_queue_inst_pop_n(&s_check_queue, CHECK_BATCH_SIZE);
+    success &= (msg_queue_inst_peek(&s_check_queue) == NULL);
+
+    return success;
+}
+
+static bool check_lanes_strict(void)
+{
+    uint8_t order[2 * CHECK_LANE_SIZE];
+    bool    success = check_lanes_serve(&s_check_strict, order);
+
+    for (uint8_t msg_idx = 0; msg_idx < 2 * CHECK_LANE_SIZE; msg_idx++)
+    {
+        success &= (order[msg_idx] == msg_idx / CHECK_LANE_SIZE);
+    }
+
+    return success;
+}
+
+static bool check_lanes_weighted(void)
+{
+    // Restarts from the first lane, as after the definition.
+    s_check_weighted.current_lane   = s_check_weighted.nb_lanes - 1;
+    s_check_weighted.credits        = 0;
+
+    uint8_t order[2 * CHECK_LANE_SIZE];
+    bool    success = check_lanes_serve(&s_check_weighted, order);
+
+    success &= (memcmp(order, CHECK_WEIGHTED_ORDER, sizeof(order)) == 0);
+
+    return success;
+}
+
+static bool check_lanes_default(void)
+{
+    const uint8_t lanes[] = { MSG_QUEUE_LANE_DATA, MSG_QUEUE_LANE_CONTROL };
+    bool          success = true;
+
+    msg_queue_lane_select_set(check_lane_select);
+
+    for (uint8_t msg_idx = 0; msg_idx < sizeof(lanes); msg_idx++)
+    {
+        success &= msg_queue_enqueue(&(lanes[msg_idx]), 1);
+    }
+
+    // The control message overtakes the data one.
+    for (uint8_t msg_idx = sizeof(lanes); msg_idx > 0; msg_idx--)
+    {
+        const tx_buffer_t* queue_head = msg_queue_peek();
+        if (queue_head == NULL)
+        {
+            success = false;
+            break;
+        }
+
+        success &= (queue_head->buffer[0] == lanes[msg_idx - 1]);
+        msg_queue_pop();
+    }
+
+    success &= (msg_queue_peek() == NULL);
+
+    msg_queue_lane_select_set(NULL);
+
+    return success;
+}
+
+static bool check_lanes_serve(msg_queue_lanes_t* lanes, uint8_t* order)
+{
+    bool success = true;
+
+    for (uint8_t lane_idx = 0; lane_idx < lanes->nb_lanes; lane_idx++)
+    {
+        for (uint8_t msg_idx = 0; msg_idx < CHECK_LANE_SIZE; msg_idx++)
+        {
+            success &= msg_queue_lanes_enqueue(lanes, lane_idx, &lane_idx,
+                                               1);
+        }
+    }
+
+    for (uint8_t msg_idx = 0; msg_idx < 2 * CHECK_LANE_SIZE; msg_idx++)
+    {
+        const tx_buffer_t* queue_head = msg_queue_lanes_peek(lanes);
+        if (queue_head == NULL)
+        {
+            return false;
+        }
+
+        order[msg_idx] = queue_head->buffer[0];
+        msg_queue_lanes_pop(lanes);
+    }
+
+    success &= (msg_queue_lanes_peek(lanes) == NULL);
+
+    return success;
+}
+
+static void check_message_fill(uint8_t* data, uint16_t msg_idx,
+                               uint16_t size)
+{
+    for (uint16_t byte_idx = 0; byte_idx < size; byte_idx++)
+    {
+        data[byte_idx] = (uint8_t)(msg_idx + byte_idx);
+    }
+}
+
+static uint16_t check_message_size(uint16_t msg_idx)
+{
+    return 1 + (msg_idx * 37) % TX_BUF_SIZE;
+}
+
 static void uart_cb(app_uart_evt_t* event)
 {
     switch(event->evt_type)
     {
     case APP_UART_DATA_READY:
-        manage_received_data();
+        while (manage_received_data());
         break;
     case APP_UART_TX_EMPTY:
         NRF_LOG_INFO("printf complete!");
@@ -207,3 +690,9 @@ static void uart_cb(app_uart_evt_t* event)
         break;
     }
 }
+
+static msg_queue_lane_idx_t check_lane_select(const uint8_t* data,
+                                              uint16_t size)
+{
+    return (msg_queue_lane_idx_t)data[0];
+}
@@ -2,18 +2,26 @@
 
 // C STANDARD
 #include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
 #include <string.h>         // memset
 
 // NRF
 #include "ble_nus_c.h"      // ble_nus_c_t
 #include "boards.h"         // bsp_board_led_*
 #include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "nrf_sdh_ble.h"    // NRF_SDH_BLE_OBSERVER
 #include "sdk_errors.h"     // ret_code_t
 
 // NRF APPS
 #include "app_button.h"     // app_button_*
 #include "app_error.h"      // APP_ERROR_CHECK
-#include "app_timer.h"      // APP_TIMER_TICKS
+#include "app_timer.h"      // APP_TIMER_TICKS, app_timer_cnt_*
+
+// SOFTDEVICE
+#include "ble.h"            // ble_evt_t
+#include "ble_gap.h"        // BLE_GAP_EVT_*
+#include "ble_types.h"      // BLE_CONN_HANDLE_INVALID
 
 // HAL
 #include "luos_hal_board.h" // LuosHAL_BoardInit
@@ -43,6 +51,26 @@ static const uint8_t    LED_IDX     = BSP_BOARD_LED_0;
 // Button detection delay.
 static const uint32_t BTN_DTX_DELAY = APP_TIMER_TICKS(50);
 
+// Connection timestamp, to measure the time until the link is ready.
+typedef struct
+{
+    // Connection handle, or BLE_CONN_HANDLE_INVALID if unused.
+    uint16_t    conn_handle;
+
+    // RTC counter value at connection.
+    uint32_t    ticks;
+} connection_t;
+
+// Timestamps of the current connections.
+static connection_t s_connections[PTP_CLIENT_MAX_LINKS];
+
+// RTC ticks per second, as configured for the app timer.
+#define TICKS_PER_S     \
+    (APP_TIMER_CLOCK_FREQ / (APP_TIMER_CONFIG_RTC_FREQUENCY + 1))
+
+// Connection timestamps BLE observer priority.
+#define TIMESTAMP_BLE_OBS_PRIO  3
+
 /*      STATIC FUNCTIONS                                            */
 
 // Initializes the static PTP client instance.
@@ -56,14 +84,30 @@ static void set_led_state(bool state);
 
 /*      CALLBACKS                                                   */
 
-/* DB Discovery complete:   Assigns the internal handles.
+/* DB Discovery complete:   Assigns the internal handles and enables
+**                          notifications.
 ** Notification:            Sets the LED state accordingly.
+** CCCD written:            Logs the time since the connection.
+** Cache stale:             Logs it: the HAL runs the DB discovery.
 */
 static void ptp_client_evt_handler(const ptp_client_evt_t* event,
                                    ptp_client_t* instance);
 
-/* If the index is the defined one, toggles the LED and writes on
-** server.
+/* Connected:       Stores the connection timestamp.
+** Disconnected:    Frees it.
+*/
+static void timestamp_on_ble_evt(ble_evt_t const* event, void* context);
+
+NRF_SDH_BLE_OBSERVER(s_timestamp_ble_obs, TIMESTAMP_BLE_OBS_PRIO,
+                     timestamp_on_ble_evt, NULL);
+
+/* Returns the timestamp of the given connection, or NULL if it is
+** unknown.
+*/
+static connection_t* connection_get(uint16_t conn_handle);
+
+/* If the index is the defined one, toggles the LED and writes on every
+** connected server.
 */
 static void button_evt_handler(uint8_t btn_idx, uint8_t event);
 
@@ -71,6 +115,11 @@ int main(void)
 {
     LuosHAL_BoardInit();
 
+    for (uint8_t link_idx = 0; link_idx < PTP_CLIENT_MAX_LINKS; link_idx++)
+    {
+        s_connections[link_idx].conn_handle = BLE_CONN_HANDLE_INVALID;
+    }
+
     LuosHAL_BleInit();
 
     init_ptp_client();
@@ -79,7 +128,14 @@ int main(void)
     LuosHAL_BleSetup();
     LuosHAL_BleConnect();
 
-    while (true);
+    ret_code_t err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps between the events, handled by the callbacks.
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
 }
 
 static void init_ptp_client(void)
@@ -128,13 +184,34 @@ static void ptp_client_evt_handler(const ptp_client_evt_t* event,
     switch (event->evt_type)
     {
     case PTP_C_DB_DISCOVERY_COMPLETE:
-        ptp_client_handles_assign(instance, &(event->content.disc_db));
-        ptp_client_ptp_notification_enable(instance, true);
+        ptp_client_link_handles_assign(instance, event->conn_handle,
+                                       &(event->content.disc_db));
+        ptp_client_link_notification_enable(instance,
+                                            event->conn_handle, true);
         app_button_enable();
         break;
     case PTP_C_NOTIFICATION_RECEIVED:
         set_led_state((bool)(event->content.value));
         break;
+    case PTP_C_CCCD_WRITTEN:
+    {
+        connection_t* connection = connection_get(event->conn_handle);
+        if (connection == NULL)
+        {
+            break;
+        }
+
+        uint32_t ticks = app_timer_cnt_diff_compute(app_timer_cnt_get(),
+                                                    connection->ticks);
+
+        NRF_LOG_INFO("PTP link ready in %lu ms (%s)!",
+                     ticks * 1000 / TICKS_PER_S,
+                     event->cached ? "cached handles" : "discovery");
+    }
+        break;
+    case PTP_C_DB_CACHE_STALE:
+        NRF_LOG_INFO("PTP client: cached handles stale!");
+        break;
     default:
         NRF_LOG_INFO("PTP client: Unknown event!");
         break;
@@ -150,5 +227,57 @@ static void button_evt_handler(uint8_t btn_idx, uint8_t event)
 
     bool state = (event == APP_BUTTON_PUSH);
     set_led_state(state);
-    ptp_client_ptp_char_write(&s_ptp_client, (ptp_char_value_t)state);
+
+    for (uint8_t link_idx = 0; link_idx < PTP_CLIENT_MAX_LINKS; link_idx++)
+    {
+        uint16_t conn_handle = s_ptp_client.links[link_idx].conn_handle;
+        if (conn_handle != BLE_CONN_HANDLE_INVALID)
+        {
+            ptp_client_link_char_write(&s_ptp_client, conn_handle,
+                                       (ptp_char_value_t)state);
+        }
+    }
+}
+
+static void timestamp_on_ble_evt(ble_evt_t const* event, void* context)
+{
+    uint16_t conn_handle = event->evt.gap_evt.conn_handle;
+
+    switch (event->header.evt_id)
+    {
+    case BLE_GAP_EVT_CONNECTED:
+    {
+        connection_t* connection = connection_get(BLE_CONN_HANDLE_INVALID);
+        if (connection != NULL)
+        {
+            connection->conn_handle = conn_handle;
+            connection->ticks       = app_timer_cnt_get();
+        }
+    }
+        break;
+    case BLE_GAP_EVT_DISCONNECTED:
+    {
+        connection_t* connection = connection_get(conn_handle);
+        if (connection != NULL)
+        {
+            connection->conn_handle = BLE_CONN_HANDLE_INVALID;
+        }
+    }
+        break;
+    default:
+        break;
+    }
+}
+
+static connection_t* connection_get(uint16_t conn_handle)
+{
+    for (uint8_t link_idx = 0; link_idx < PTP_CLIENT_MAX_LINKS; link_idx++)
+    {
+        if (s_connections[link_idx].conn_handle == conn_handle)
+        {
+            return &(s_connections[link_idx]);
+        }
+    }
+
+    return NULL;
 }
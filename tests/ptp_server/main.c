@@ -6,6 +6,7 @@
 
 // NRF
 #include "boards.h"         // bsp_board_led_*
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
 
 // NRF APPS
 #include "app_button.h"     // app_button_*
@@ -71,10 +72,21 @@ int main(void)
     LuosHAL_BleSetup();
     LuosHAL_BleConnect();
 
-    while (s_ptp_server.conn_handle == BLE_CONN_HANDLE_INVALID);
+    ret_code_t err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps until connected, then between the events.
+    while (s_ptp_server.conn_handle == BLE_CONN_HANDLE_INVALID)
+    {
+        nrf_pwr_mgmt_run();
+    }
+
     app_button_enable();
 
-    while (true);
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
 }
 
 static void init_ptp_server(void)
@@ -0,0 +1,339 @@
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+#include <stdio.h>          // printf, snprintf
+#include <string.h>         // memset, strncmp
+#include <unistd.h>         // read
+
+// NRF
+#include "nrf.h"            // DWT, CoreDebug
+#include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "nrf_uart.h"       // NRF_UART_BAUDRATE_115200
+#include "sdk_errors.h"     // ret_code_t
+
+// NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // app_timer_init
+#include "app_uart.h"       // app_uart_*
+
+// LUOS
+#include "luos_hal_board.h" // LuosHAL_BoardInit
+
+// CUSTOM
+#include "route_table.h"    // ROUTE_TABLE_DEF, route_table_*
+#include "uart_helpers.h"   // uart_init_ex, uart_init_t, RX_BUFFER_SIZE
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Numbers of entries benchmarked.
+static const uint16_t   NB_ENTRIES[]    = { 20, 200 };
+
+// Maximum number of entries.
+#define MAX_ENTRIES         200
+
+// Number of lookups of each kind per benchmark.
+#define NB_LOOKUPS          500
+
+// Containers per node.
+#define CONTAINERS_PER_NODE 8
+
+// Names of the container types, used in the aliases.
+static const char* const TYPE_NAMES[]   =
+{
+    "gate", "servo", "led", "button", "potentiometer", "imu", "dcmotor",
+    "distance", "light", "relay", "stepper", "voltage",
+};
+
+// Number of container types.
+#define NB_TYPES            (sizeof(TYPE_NAMES) / sizeof(TYPE_NAMES[0]))
+
+// Routing table instance.
+ROUTE_TABLE_DEF(s_table, MAX_ENTRIES);
+
+// Cycles taken by the lookups of a kind.
+typedef struct
+{
+    uint32_t    linear;
+    uint32_t    indexed;
+    uint32_t    mismatch_count;
+} lookup_cycles_t;
+
+// Pseudo-random generator state, for the lookups.
+static uint32_t         s_random        = 1;
+
+// Line being received.
+static char             s_line[RX_BUFFER_SIZE + 1]  = { 0 };
+
+// Size of the line being received.
+static uint16_t         s_line_size     = 0;
+
+// Stop char
+static const char       STOP_CHAR       = '\r';
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Reads the received characters until a line is complete, then runs the
+** benchmark. Returns false if there was nothing to read.
+*/
+static bool manage_received_data(void);
+
+/* Fills the routing table with the given number of containers, as a
+** detection would, then prints the cycles taken by the alias, ID and
+** type lookups with and without the indexes.
+*/
+static void benchmark_run(uint16_t nb_entries);
+
+// Writes in `alias` the alias of the container of the given ID.
+static void alias_make(char* alias, uint16_t id);
+
+// Prints the given lookup cycles.
+static void cycles_print(const char* name, const lookup_cycles_t* cycles);
+
+// Reference lookups, scanning the routing table entries.
+static uint16_t linear_id_from_alias(const char* alias);
+static uint16_t linear_node_from_id(uint16_t id);
+static uint16_t linear_type_count(uint8_t type);
+
+// Returns the next pseudo-random number.
+static uint32_t random_next(void);
+
+/*      CALLBACKS                                                   */
+
+/* Data ready:  Calls the data management function until there is
+**              nothing left to read.
+** TX empty:    Does nothing.
+** UART data:   Not supposed to happen.
+** FIFO error:  Logs error.
+** Com error:   Logs error.
+*/
+static void uart_cb(app_uart_evt_t* event);
+
+int main(void)
+{
+    LuosHAL_BoardInit();
+
+    // Needed for UART idle line detection.
+    ret_code_t err_code = app_timer_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Cycle counter, for the benchmark.
+    CoreDebug->DEMCR    |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT         = 0;
+    DWT->CTRL           |= DWT_CTRL_CYCCNTENA_Msk;
+
+    uart_init_t uart_params;
+    memset(&uart_params, 0, sizeof(uart_init_t));
+
+    uart_params.evt_handler     = uart_cb;
+    uart_params.baudrate        = NRF_UART_BAUDRATE_115200;
+    uart_params.flow_control    = false;
+    uart_params.rx_buffer_size  = RX_BUFFER_SIZE;
+
+    uart_init_ex(&uart_params);
+
+    err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps between the events, handled by the callbacks.
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
+}
+
+static bool manage_received_data(void)
+{
+    ssize_t read_bytes = read(0, s_line + s_line_size, 1);
+    if (read_bytes <= 0)
+    {
+        return false;
+    }
+
+    s_line_size++;
+
+    bool complete = (s_line[s_line_size - 1] == STOP_CHAR);
+    if (!complete && (s_line_size < RX_BUFFER_SIZE))
+    {
+        // Line is incomplete.
+        return true;
+    }
+
+    s_line_size = 0;
+
+    for (uint8_t run_idx = 0;
+         run_idx < sizeof(NB_ENTRIES) / sizeof(NB_ENTRIES[0]); run_idx++)
+    {
+        benchmark_run(NB_ENTRIES[run_idx]);
+    }
+
+    return true;
+}
+
+static void benchmark_run(uint16_t nb_entries)
+{
+    char alias[ROUTE_TABLE_ALIAS_SIZE];
+
+    // Detection: IDs are given from 1, node by node.
+    route_table_clear(&s_table);
+
+    for (uint16_t id = 1; id <= nb_entries; id++)
+    {
+        alias_make(alias, id);
+        route_table_add(&s_table, id, 1 + (id - 1) / CONTAINERS_PER_NODE,
+                        id % NB_TYPES, alias);
+    }
+
+    s_random = 1;
+
+    lookup_cycles_t alias_cycles;
+    lookup_cycles_t node_cycles;
+    lookup_cycles_t type_cycles;
+    memset(&alias_cycles, 0, sizeof(lookup_cycles_t));
+    memset(&node_cycles, 0, sizeof(lookup_cycles_t));
+    memset(&type_cycles, 0, sizeof(lookup_cycles_t));
+
+    for (uint16_t lookup_idx = 0; lookup_idx < NB_LOOKUPS; lookup_idx++)
+    {
+        // One lookup out of eight misses.
+        uint16_t    id      = 1 + random_next() % (nb_entries
+                                                   + nb_entries / 8);
+        uint8_t     type    = random_next() % NB_TYPES;
+
+        alias_make(alias, id);
+
+        uint32_t start      = DWT->CYCCNT;
+        uint16_t linear     = linear_id_from_alias(alias);
+        uint32_t middle     = DWT->CYCCNT;
+        uint16_t indexed    = route_table_id_from_alias(&s_table, alias);
+        uint32_t end        = DWT->CYCCNT;
+
+        alias_cycles.linear         += middle - start;
+        alias_cycles.indexed        += end - middle;
+        alias_cycles.mismatch_count += (linear != indexed);
+
+        start   = DWT->CYCCNT;
+        linear  = linear_node_from_id(id);
+        middle  = DWT->CYCCNT;
+        indexed = route_table_node_from_id(&s_table, id);
+        end     = DWT->CYCCNT;
+
+        node_cycles.linear          += middle - start;
+        node_cycles.indexed         += end - middle;
+        node_cycles.mismatch_count  += (linear != indexed);
+
+        start   = DWT->CYCCNT;
+        linear  = linear_type_count(type);
+        middle  = DWT->CYCCNT;
+        indexed = 0;
+        for (const route_table_entry_t* entry
+             = route_table_type_first(&s_table, type);
+             entry != NULL; entry = route_table_type_next(&s_table, entry))
+        {
+            indexed++;
+        }
+        end     = DWT->CYCCNT;
+
+        type_cycles.linear          += middle - start;
+        type_cycles.indexed         += end - middle;
+        type_cycles.mismatch_count  += (linear != indexed);
+    }
+
+    printf("%u entries: %u lookups of each kind!\r\n", nb_entries,
+           NB_LOOKUPS);
+    cycles_print("Alias to ID", &alias_cycles);
+    cycles_print("ID to node", &node_cycles);
+    cycles_print("Type to containers", &type_cycles);
+}
+
+static void alias_make(char* alias, uint16_t id)
+{
+    snprintf(alias, ROUTE_TABLE_ALIAS_SIZE, "%s%u",
+             TYPE_NAMES[id % NB_TYPES], id);
+}
+
+static void cycles_print(const char* name, const lookup_cycles_t* cycles)
+{
+    uint32_t linear_avg     = cycles->linear * 100 / NB_LOOKUPS;
+    uint32_t indexed_avg    = cycles->indexed * 100 / NB_LOOKUPS;
+
+    printf("  %s: %lu.%02lu -> %lu.%02lu cycles/lookup, %lu "
+           "mismatches!\r\n", name, linear_avg / 100, linear_avg % 100,
+           indexed_avg / 100, indexed_avg % 100, cycles->mismatch_count);
+}
+
+static uint16_t linear_id_from_alias(const char* alias)
+{
+    for (uint16_t entry_idx = 0; entry_idx < s_table.nb_entries;
+         entry_idx++)
+    {
+        const route_table_entry_t* entry = &(s_table.entries[entry_idx]);
+
+        if (strncmp(entry->alias, alias, ROUTE_TABLE_ALIAS_SIZE) == 0)
+        {
+            return entry->id;
+        }
+    }
+
+    return ROUTE_TABLE_INVALID_ID;
+}
+
+static uint16_t linear_node_from_id(uint16_t id)
+{
+    for (uint16_t entry_idx = 0; entry_idx < s_table.nb_entries;
+         entry_idx++)
+    {
+        if (s_table.entries[entry_idx].id == id)
+        {
+            return s_table.entries[entry_idx].node_id;
+        }
+    }
+
+    return ROUTE_TABLE_INVALID_ID;
+}
+
+static uint16_t linear_type_count(uint8_t type)
+{
+    uint16_t count = 0;
+
+    for (uint16_t entry_idx = 0; entry_idx < s_table.nb_entries;
+         entry_idx++)
+    {
+        count += (s_table.entries[entry_idx].type == type);
+    }
+
+    return count;
+}
+
+static uint32_t random_next(void)
+{
+    s_random = s_random * 1103515245 + 12345;
+
+    return (s_random >> 16);
+}
+
+static void uart_cb(app_uart_evt_t* event)
+{
+    switch(event->evt_type)
+    {
+    case APP_UART_DATA_READY:
+        while (manage_received_data());
+        break;
+    case APP_UART_TX_EMPTY:
+        break;
+    case APP_UART_DATA:
+        NRF_LOG_INFO("Non-FIFO data received (\?\?\?)");
+        break;
+    case APP_UART_FIFO_ERROR:
+        NRF_LOG_INFO("Fifo error!");
+        break;
+    case APP_UART_COMMUNICATION_ERROR:
+        NRF_LOG_INFO("Communication error!");
+        break;
+    default:
+        NRF_LOG_INFO("Unknown type!");
+        break;
+    }
+}
@@ -0,0 +1,354 @@
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdatomic.h>      // atomic_bool, atomic_*
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+#include <stdio.h>          // printf
+#include <string.h>         // memset
+#include <unistd.h>         // read
+
+// NRF
+#include "nrf.h"            // DWT, CoreDebug
+#include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_uart.h"       // NRF_UART_BAUDRATE_115200
+#include "sdk_errors.h"     // ret_code_t
+
+// NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // APP_TIMER_*, app_timer_*
+#include "app_uart.h"       // app_uart_*
+
+// LUOS
+#include "luos_hal_board.h" // LuosHAL_BoardInit
+
+// CUSTOM
+#include "run_loop.h"       /* RUN_LOOP_DEF, run_loop_*, run_loop_init_t,
+                            ** run_loop_task_t, RUN_LOOP_EVT_LUOS_RX
+                            */
+#include "uart_helpers.h"   // uart_init_ex, uart_init_t, RX_BUFFER_SIZE
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Number of received messages per benchmark.
+#define NB_MESSAGES         200
+
+// Range of the time between two received messages.
+#define MIN_PERIOD_MS       1
+#define MAX_PERIOD_MS       8
+
+// Results of a main loop.
+typedef struct
+{
+    // Number of rounds of the main loop, and of rounds which slept.
+    uint32_t    round_count;
+    uint32_t    sleep_count;
+
+    // Cycles from the reception of the messages to their handling.
+    uint32_t    latency_sum;
+    uint32_t    latency_max;
+} loop_results_t;
+
+// Run loop, calling the message handler on reception.
+RUN_LOOP_DEF(s_run_loop);
+
+// Timer simulating the reception of the messages.
+APP_TIMER_DEF(s_rx_timer);
+
+// Cycle counter values at the reception of the messages.
+static uint32_t         s_rx_cycles[NB_MESSAGES];
+
+// Number of received and handled messages.
+static _Atomic uint16_t s_rx_count      = 0;
+static uint16_t         s_handled_count = 0;
+
+// True if the reception shall raise the run loop event.
+static atomic_bool      s_event_driven  = false;
+
+// Results of the current benchmark.
+static loop_results_t   s_results;
+
+// True if the main loop shall run the benchmark.
+static atomic_bool      s_run_requested = false;
+
+// Pseudo-random generator state, for the reception times.
+static uint32_t         s_random        = 1;
+
+// Line being received.
+static char             s_line[RX_BUFFER_SIZE + 1]  = { 0 };
+
+// Size of the line being received.
+static uint16_t         s_line_size     = 0;
+
+// Stop char
+static const char       STOP_CHAR       = '\r';
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Reads the received characters until a line is complete, then requests
+** the benchmark. Returns false if there was nothing to read.
+*/
+static bool manage_received_data(void);
+
+/* Receives the same messages with a busy-polling main loop and with the
+** run loop, and prints the rounds per message and the latency of both.
+*/
+static void benchmark_run(void);
+
+/* Receives the messages, calling the message handler from the run loop
+** if the given value is true, or as fast as possible otherwise. Stores
+** the results in `results`.
+*/
+static void loop_run(bool event_driven, loop_results_t* results);
+
+// Prints the given results.
+static void results_print(const char* name, const loop_results_t* results);
+
+// Starts the reception timer for the next message.
+static void rx_timer_start(void);
+
+// Returns the next pseudo-random number.
+static uint32_t random_next(void);
+
+/*      CALLBACKS                                                   */
+
+/* Handles the received messages: stores the cycles since their
+** reception, as a Luos loop would dispatch them.
+*/
+static void message_handle(void);
+
+// Module loops of the run loop.
+static const run_loop_task_t LOOP_TASKS[] =
+{
+    { message_handle,   RUN_LOOP_EVT_LUOS_RX },
+};
+
+/* Stores the reception time of a message, raises the run loop event if
+** needed, and starts the timer for the next message.
+*/
+static void rx_timeout(void* context);
+
+/* Data ready:  Calls the data management function until there is
+**              nothing left to read.
+** TX empty:    Does nothing.
+** UART data:   Not supposed to happen.
+** FIFO error:  Logs error.
+** Com error:   Logs error.
+*/
+static void uart_cb(app_uart_evt_t* event);
+
+int main(void)
+{
+    LuosHAL_BoardInit();
+
+    // Needed for UART idle line detection and for the reception timer.
+    ret_code_t err_code = app_timer_init();
+    APP_ERROR_CHECK(err_code);
+
+    err_code = app_timer_create(&s_rx_timer, APP_TIMER_MODE_SINGLE_SHOT,
+                                rx_timeout);
+    APP_ERROR_CHECK(err_code);
+
+    // Cycle counter, for the latency.
+    CoreDebug->DEMCR    |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT         = 0;
+    DWT->CTRL           |= DWT_CTRL_CYCCNTENA_Msk;
+
+    uart_init_t uart_params;
+    memset(&uart_params, 0, sizeof(uart_init_t));
+
+    uart_params.evt_handler     = uart_cb;
+    uart_params.baudrate        = NRF_UART_BAUDRATE_115200;
+    uart_params.flow_control    = false;
+    uart_params.rx_buffer_size  = RX_BUFFER_SIZE;
+
+    uart_init_ex(&uart_params);
+
+    run_loop_init_t loop_params;
+    memset(&loop_params, 0, sizeof(run_loop_init_t));
+
+    loop_params.tasks           = LOOP_TASKS;
+    loop_params.nb_tasks        = sizeof(LOOP_TASKS) / sizeof(LOOP_TASKS[0]);
+    loop_params.tick_period_ms  = 0;
+
+    run_loop_init(&s_run_loop, &loop_params);
+
+    while (true)
+    {
+        if (atomic_exchange(&s_run_requested, false))
+        {
+            benchmark_run();
+        }
+
+        run_loop_step(&s_run_loop);
+    }
+}
+
+static bool manage_received_data(void)
+{
+    ssize_t read_bytes = read(0, s_line + s_line_size, 1);
+    if (read_bytes <= 0)
+    {
+        return false;
+    }
+
+    s_line_size++;
+
+    bool complete = (s_line[s_line_size - 1] == STOP_CHAR);
+    if (!complete && (s_line_size < RX_BUFFER_SIZE))
+    {
+        // Line is incomplete.
+        return true;
+    }
+
+    s_line_size = 0;
+
+    // The benchmark needs the main loop: the callbacks shall return.
+    atomic_store(&s_run_requested, true);
+
+    return true;
+}
+
+static void benchmark_run(void)
+{
+    loop_results_t busy_results;
+    loop_results_t event_results;
+
+    loop_run(false, &busy_results);
+    loop_run(true, &event_results);
+
+    printf("%u messages, every %u to %u ms!\r\n", NB_MESSAGES,
+           MIN_PERIOD_MS, MAX_PERIOD_MS);
+    results_print("Busy polling", &busy_results);
+    results_print("Run loop", &event_results);
+}
+
+static void loop_run(bool event_driven, loop_results_t* results)
+{
+    memset(&s_results, 0, sizeof(loop_results_t));
+
+    s_handled_count = 0;
+    atomic_store(&s_rx_count, 0);
+    atomic_store(&s_event_driven, event_driven);
+    s_random        = 1;
+
+    run_loop_stats_t stats_before = s_run_loop.stats;
+
+    rx_timer_start();
+
+    while (s_handled_count < NB_MESSAGES)
+    {
+        if (event_driven)
+        {
+            run_loop_step(&s_run_loop);
+        }
+        else
+        {
+            s_results.round_count++;
+            message_handle();
+        }
+    }
+
+    if (event_driven)
+    {
+        const run_loop_stats_t* stats = &(s_run_loop.stats);
+
+        s_results.sleep_count   = stats->sleep_count
+                                  - stats_before.sleep_count;
+        s_results.round_count   = stats->iteration_count
+                                  - stats_before.iteration_count
+                                  + s_results.sleep_count;
+    }
+
+    *results = s_results;
+}
+
+static void results_print(const char* name, const loop_results_t* results)
+{
+    uint32_t rounds_avg     = results->round_count * 100 / NB_MESSAGES;
+    uint32_t sleeps_avg     = results->sleep_count * 100 / NB_MESSAGES;
+    uint32_t latency_avg    = results->latency_sum * 100 / NB_MESSAGES;
+
+    printf("  %s: %lu.%02lu rounds/message (%lu.%02lu asleep), latency "
+           "%lu.%02lu cycles (max %lu)!\r\n", name, rounds_avg / 100,
+           rounds_avg % 100, sleeps_avg / 100, sleeps_avg % 100,
+           latency_avg / 100, latency_avg % 100, results->latency_max);
+}
+
+static void rx_timer_start(void)
+{
+    uint32_t period_ms = MIN_PERIOD_MS
+                         + random_next() % (MAX_PERIOD_MS - MIN_PERIOD_MS
+                                            + 1);
+
+    ret_code_t err_code = app_timer_start(s_rx_timer,
+                                          APP_TIMER_TICKS(period_ms), NULL);
+    APP_ERROR_CHECK(err_code);
+}
+
+static uint32_t random_next(void)
+{
+    s_random = s_random * 1103515245 + 12345;
+
+    return (s_random >> 16);
+}
+
+static void message_handle(void)
+{
+    uint16_t rx_count = atomic_load(&s_rx_count);
+
+    while (s_handled_count < rx_count)
+    {
+        uint32_t latency = DWT->CYCCNT - s_rx_cycles[s_handled_count];
+
+        s_results.latency_sum += latency;
+        if (latency > s_results.latency_max)
+        {
+            s_results.latency_max = latency;
+        }
+
+        s_handled_count++;
+    }
+}
+
+static void rx_timeout(void* context)
+{
+    uint16_t rx_count = atomic_load(&s_rx_count);
+
+    s_rx_cycles[rx_count] = DWT->CYCCNT;
+    atomic_store(&s_rx_count, rx_count + 1);
+
+    if (atomic_load(&s_event_driven))
+    {
+        run_loop_evt_set(&s_run_loop, RUN_LOOP_EVT_LUOS_RX);
+    }
+
+    if (rx_count + 1 < NB_MESSAGES)
+    {
+        rx_timer_start();
+    }
+}
+
+static void uart_cb(app_uart_evt_t* event)
+{
+    switch(event->evt_type)
+    {
+    case APP_UART_DATA_READY:
+        while (manage_received_data());
+        break;
+    case APP_UART_TX_EMPTY:
+        break;
+    case APP_UART_DATA:
+        NRF_LOG_INFO("Non-FIFO data received (\?\?\?)");
+        break;
+    case APP_UART_FIFO_ERROR:
+        NRF_LOG_INFO("Fifo error!");
+        break;
+    case APP_UART_COMMUNICATION_ERROR:
+        NRF_LOG_INFO("Communication error!");
+        break;
+    default:
+        NRF_LOG_INFO("Unknown type!");
+        break;
+    }
+}
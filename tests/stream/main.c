@@ -0,0 +1,477 @@
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+#include <stdio.h>          // printf
+#include <string.h>         // memcpy, memset
+#include <unistd.h>         // read
+
+// NRF
+#include "nrf.h"            // DWT, CoreDebug
+#include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "nrf_uart.h"       // NRF_UART_BAUDRATE_115200
+#include "sdk_errors.h"     // ret_code_t
+
+// NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // app_timer_init
+#include "app_uart.h"       // app_uart_*
+
+// LUOS
+#include "luos_hal_board.h" // LuosHAL_BoardInit
+
+// CUSTOM
+#include "msg_queue.h"      // MSG_QUEUE_DEF, msg_queue_*
+#include "stream.h"         // stream_*
+#include "uart_helpers.h"   // uart_init_ex, uart_init_t, RX_BUFFER_SIZE
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Number of simulated ticks of 1 ms.
+#define NB_TICKS            2000
+
+// Maximum sample rate, in samples per tick.
+#define MAX_RATE            8
+
+// Size of a sample: three 16-bit axes.
+#define SAMPLE_SIZE         6
+
+// Connection interval, in ticks.
+#define CONN_INTERVAL       8
+
+// Packets the link can send per connection event.
+#define LINK_PACKETS        6
+
+// Size of a chunk, fitting a data length extended packet.
+#define CHUNK_SIZE          240
+
+// Chunks the receiver can hold, and consumes per tick.
+#define STREAM_WINDOW       4
+#define RX_CONSUME          2
+
+/* The receiving application is busy, and consumes nothing, for a number
+** of ticks out of this period: credits then hold the sender back.
+*/
+#define RX_BUSY_PERIOD      500
+#define RX_BUSY_TICKS       20
+
+// Maximum number of credits messages waiting for the next event.
+#define MAX_GRANTS          8
+
+// Size of a Luos message header, and of a message carrying a sample.
+#define LUOS_HEADER_SIZE    7
+#define LUOS_MSG_SIZE       (LUOS_HEADER_SIZE + SAMPLE_SIZE)
+
+// Number of Luos messages the reference queue holds: same storage size.
+#define LUOS_QUEUE_DEPTH    (MSG_QUEUE_RING_SIZE(STREAM_WINDOW, CHUNK_SIZE) \
+                             / MSG_QUEUE_RECORD_SIZE(LUOS_MSG_SIZE) - 1)
+
+// Queue of the stream chunks.
+MSG_QUEUE_DEF(s_stream_queue, STREAM_WINDOW, CHUNK_SIZE);
+
+// Queue of the Luos messages, for the reference path.
+MSG_QUEUE_DEF(s_luos_queue, LUOS_QUEUE_DEPTH, LUOS_MSG_SIZE);
+
+// Streaming channel ends.
+static stream_tx_t      s_tx;
+static stream_rx_t      s_rx;
+
+// Credits messages sent by the receiver, delivered at the next event.
+static uint8_t          s_grants[MAX_GRANTS][STREAM_HEADER_SIZE];
+static uint8_t          s_nb_grants     = 0;
+
+// Chunks received and not consumed yet.
+static uint16_t         s_rx_backlog    = 0;
+
+// Results of a run.
+typedef struct
+{
+    // Number of produced, dropped and received samples.
+    uint32_t    produced;
+    uint32_t    dropped;
+    uint32_t    received;
+
+    // Producer cycles, over all samples.
+    uint32_t    cycles;
+
+    // Number of bytes copied between the producer and the radio.
+    uint32_t    copied_bytes;
+
+    // Number of times the receiver held more chunks than its window.
+    uint32_t    overflow_count;
+} run_result_t;
+
+// Pseudo-random generator state, for the samples.
+static uint32_t         s_random        = 1;
+
+// Line being received.
+static char             s_line[RX_BUFFER_SIZE + 1]  = { 0 };
+
+// Size of the line being received.
+static uint16_t         s_line_size     = 0;
+
+// Stop char
+static const char       STOP_CHAR       = '\r';
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Reads the received characters until a line is complete, then runs the
+** benchmark at the sample rate it holds, in kHz, or at every rate if
+** there is none. Returns false if there was nothing to read.
+*/
+static bool manage_received_data(void);
+
+/* Streams samples at the given rate over the simulated link, through a
+** streaming channel and through Luos messages, and prints the sustained
+** throughput of both.
+*/
+static void benchmark_run(uint8_t rate);
+
+// Runs the streaming channel path at the given rate.
+static void stream_run(uint8_t rate, run_result_t* result);
+
+/* Runs the reference path at the given rate: each sample is put in a
+** Luos message, enqueued, then copied in a notification.
+*/
+static void luos_run(uint8_t rate, run_result_t* result);
+
+// Prints the given results.
+static void result_print(const char* name, const run_result_t* result);
+
+// Sends the given credits message at the next connection event.
+static bool grant_send(const uint8_t* data, uint16_t size);
+
+// Writes a new sample in the given buffer.
+static void sample_make(uint8_t* sample);
+
+// Returns the next pseudo-random number.
+static uint32_t random_next(void);
+
+/*      CALLBACKS                                                   */
+
+/* Data ready:  Calls the data management function until there is
+**              nothing left to read.
+** TX empty:    Does nothing.
+** UART data:   Not supposed to happen.
+** FIFO error:  Logs error.
+** Com error:   Logs error.
+*/
+static void uart_cb(app_uart_evt_t* event);
+
+int main(void)
+{
+    LuosHAL_BoardInit();
+
+    // Needed for UART idle line detection.
+    ret_code_t err_code = app_timer_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Cycle counter, for the producer cost.
+    CoreDebug->DEMCR    |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT         = 0;
+    DWT->CTRL           |= DWT_CTRL_CYCCNTENA_Msk;
+
+    uart_init_t uart_params;
+    memset(&uart_params, 0, sizeof(uart_init_t));
+
+    uart_params.evt_handler     = uart_cb;
+    uart_params.baudrate        = NRF_UART_BAUDRATE_115200;
+    uart_params.flow_control    = false;
+    uart_params.rx_buffer_size  = RX_BUFFER_SIZE;
+
+    uart_init_ex(&uart_params);
+
+    err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps between the events, handled by the callbacks.
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
+}
+
+static bool manage_received_data(void)
+{
+    ssize_t read_bytes = read(0, s_line + s_line_size, 1);
+    if (read_bytes <= 0)
+    {
+        return false;
+    }
+
+    s_line_size++;
+
+    bool complete = (s_line[s_line_size - 1] == STOP_CHAR);
+    if (!complete && (s_line_size < RX_BUFFER_SIZE))
+    {
+        // Line is incomplete.
+        return true;
+    }
+
+    uint8_t rate = 0;
+    if ((s_line[0] >= '1') && (s_line[0] <= '0' + MAX_RATE))
+    {
+        rate = s_line[0] - '0';
+    }
+
+    s_line_size = 0;
+
+    if (rate > 0)
+    {
+        benchmark_run(rate);
+        return true;
+    }
+
+    for (rate = 1; rate <= MAX_RATE; rate *= 2)
+    {
+        benchmark_run(rate);
+    }
+
+    return true;
+}
+
+static void benchmark_run(uint8_t rate)
+{
+    run_result_t result;
+
+    printf("%u kHz, %u-byte samples, %u ms!\r\n", rate, SAMPLE_SIZE,
+           NB_TICKS);
+
+    stream_run(rate, &result);
+    result_print("Stream", &result);
+    printf("    %lu chunks, %lu credit stalls, %lu lost, %lu grants!\r\n",
+           s_tx.stats.chunk_count, s_tx.stats.credit_stall_count,
+           s_rx.stats.lost_count, s_rx.stats.grant_count);
+
+    luos_run(rate, &result);
+    result_print("Luos messages", &result);
+}
+
+static void stream_run(uint8_t rate, run_result_t* result)
+{
+    memset(result, 0, sizeof(run_result_t));
+    msg_queue_inst_pop_n(&s_stream_queue,
+                         msg_queue_inst_count(&s_stream_queue));
+
+    stream_tx_init_t tx_params;
+    memset(&tx_params, 0, sizeof(stream_tx_init_t));
+
+    tx_params.queue     = &s_stream_queue;
+    tx_params.channel   = 1;
+    tx_params.window    = STREAM_WINDOW;
+
+    stream_tx_init(&s_tx, &tx_params);
+
+    stream_rx_init_t rx_params;
+    memset(&rx_params, 0, sizeof(stream_rx_init_t));
+
+    rx_params.channel   = 1;
+    rx_params.window    = STREAM_WINDOW;
+    rx_params.send      = grant_send;
+
+    stream_rx_init(&s_rx, &rx_params);
+
+    s_nb_grants     = 0;
+    s_rx_backlog    = 0;
+    s_random        = 1;
+
+    uint8_t sample[SAMPLE_SIZE];
+
+    for (uint32_t tick = 0; tick < NB_TICKS; tick++)
+    {
+        for (uint8_t sample_idx = 0; sample_idx < rate; sample_idx++)
+        {
+            sample_make(sample);
+
+            uint32_t start      = DWT->CYCCNT;
+            uint16_t written    = stream_tx_write(&s_tx, sample,
+                                                  SAMPLE_SIZE);
+            result->cycles      += DWT->CYCCNT - start;
+
+            result->produced++;
+            result->dropped         += (written < SAMPLE_SIZE);
+            result->copied_bytes    += written;
+        }
+
+        if (tick % CONN_INTERVAL == 0)
+        {
+            // Credits sent during the last interval arrive first.
+            for (uint8_t grant_idx = 0; grant_idx < s_nb_grants;
+                 grant_idx++)
+            {
+                stream_tx_on_msg(&s_tx, s_grants[grant_idx],
+                                 STREAM_HEADER_SIZE);
+            }
+            s_nb_grants = 0;
+
+            stream_tx_flush(&s_tx);
+
+            // The stack sends the chunks from the queue, without copy.
+            tx_buffer_t chunks[LINK_PACKETS];
+            uint16_t    nb_sent = msg_queue_inst_peek_n(&s_stream_queue, chunks,
+                                                        LINK_PACKETS);
+
+            for (uint16_t chunk_idx = 0; chunk_idx < nb_sent; chunk_idx++)
+            {
+                const uint8_t*  payload;
+                uint16_t        payload_size;
+
+                if (stream_rx_on_msg(&s_rx, chunks[chunk_idx].buffer,
+                                     chunks[chunk_idx].size, &payload,
+                                     &payload_size))
+                {
+                    s_rx_backlog++;
+                }
+            }
+
+            msg_queue_inst_pop_n(&s_stream_queue, nb_sent);
+
+            if (s_rx_backlog > STREAM_WINDOW)
+            {
+                result->overflow_count++;
+            }
+        }
+
+        // The receiving application consumes the chunks.
+        bool     busy       = (tick % RX_BUSY_PERIOD < RX_BUSY_TICKS);
+        uint16_t consumed   = (s_rx_backlog < RX_CONSUME) ? s_rx_backlog
+                                                          : RX_CONSUME;
+        if (busy)
+        {
+            consumed = 0;
+        }
+
+        if (consumed > 0)
+        {
+            s_rx_backlog -= consumed;
+            stream_rx_release(&s_rx, consumed);
+        }
+    }
+
+    result->received = s_rx.stats.rx_bytes / SAMPLE_SIZE;
+}
+
+static void luos_run(uint8_t rate, run_result_t* result)
+{
+    memset(result, 0, sizeof(run_result_t));
+    msg_queue_inst_pop_n(&s_luos_queue, msg_queue_inst_count(&s_luos_queue));
+
+    s_random = 1;
+
+    uint8_t sample[SAMPLE_SIZE];
+    uint8_t msg[LUOS_MSG_SIZE]      = { 0 };
+    uint8_t packet[CHUNK_SIZE];
+
+    for (uint32_t tick = 0; tick < NB_TICKS; tick++)
+    {
+        for (uint8_t sample_idx = 0; sample_idx < rate; sample_idx++)
+        {
+            sample_make(sample);
+
+            uint32_t start  = DWT->CYCCNT;
+            memcpy(msg + LUOS_HEADER_SIZE, sample, SAMPLE_SIZE);
+            bool enqueued   = msg_queue_inst_enqueue(&s_luos_queue, msg,
+                                                     LUOS_MSG_SIZE);
+            result->cycles  += DWT->CYCCNT - start;
+
+            result->produced++;
+            result->dropped         += !enqueued;
+            result->copied_bytes    += SAMPLE_SIZE
+                                       + (enqueued ? LUOS_MSG_SIZE : 0);
+        }
+
+        if (tick % CONN_INTERVAL != 0)
+        {
+            continue;
+        }
+
+        // One notification per message, copied by the stack.
+        for (uint8_t packet_idx = 0; packet_idx < LINK_PACKETS;
+             packet_idx++)
+        {
+            tx_buffer_t* view = msg_queue_inst_peek(&s_luos_queue);
+            if (view == NULL)
+            {
+                break;
+            }
+
+            memcpy(packet, view->buffer, view->size);
+            result->copied_bytes += view->size;
+            result->received++;
+
+            msg_queue_inst_pop(&s_luos_queue);
+        }
+    }
+}
+
+static void result_print(const char* name, const run_result_t* result)
+{
+    uint32_t throughput     = result->received * 1000 / NB_TICKS;
+    uint32_t drop_rate      = (result->produced > 0)
+                              ? result->dropped * 10000 / result->produced
+                              : 0;
+    uint32_t cycles_avg     = (result->produced > 0)
+                              ? result->cycles * 100 / result->produced : 0;
+    uint32_t copies_avg     = (result->produced > 0)
+                              ? result->copied_bytes * 100
+                                / result->produced : 0;
+
+    printf("  %s: %lu samples/s sustained, dropped %lu.%02lu%%!\r\n",
+           name, throughput, drop_rate / 100, drop_rate % 100);
+    printf("    %lu.%02lu producer cycles and %lu.%02lu copied bytes per "
+           "sample, %lu overflows!\r\n", cycles_avg / 100,
+           cycles_avg % 100, copies_avg / 100, copies_avg % 100,
+           result->overflow_count);
+}
+
+static bool grant_send(const uint8_t* data, uint16_t size)
+{
+    if ((s_nb_grants == MAX_GRANTS) || (size != STREAM_HEADER_SIZE))
+    {
+        return false;
+    }
+
+    memcpy(s_grants[s_nb_grants++], data, STREAM_HEADER_SIZE);
+    return true;
+}
+
+static void sample_make(uint8_t* sample)
+{
+    for (uint8_t byte_idx = 0; byte_idx < SAMPLE_SIZE; byte_idx++)
+    {
+        sample[byte_idx] = (uint8_t)random_next();
+    }
+}
+
+static uint32_t random_next(void)
+{
+    s_random = s_random * 1103515245 + 12345;
+
+    return (s_random >> 16);
+}
+
+static void uart_cb(app_uart_evt_t* event)
+{
+    switch(event->evt_type)
+    {
+    case APP_UART_DATA_READY:
+        while (manage_received_data());
+        break;
+    case APP_UART_TX_EMPTY:
+        break;
+    case APP_UART_DATA:
+        NRF_LOG_INFO("Non-FIFO data received (\?\?\?)");
+        break;
+    case APP_UART_FIFO_ERROR:
+        NRF_LOG_INFO("Fifo error!");
+        break;
+    case APP_UART_COMMUNICATION_ERROR:
+        NRF_LOG_INFO("Communication error!");
+        break;
+    default:
+        NRF_LOG_INFO("Unknown type!");
+        break;
+    }
+}
@@ -0,0 +1,360 @@
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+#include <stdio.h>          // printf
+#include <string.h>         // memset
+#include <unistd.h>         // read
+
+// NRF
+#include "nrf.h"            // DWT, CoreDebug
+#include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "nrf_uart.h"       // NRF_UART_BAUDRATE_115200
+#include "sdk_errors.h"     // ret_code_t
+
+// NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // app_timer_init
+#include "app_uart.h"       // app_uart_*
+
+// LUOS
+#include "luos_hal_board.h" // LuosHAL_BoardInit
+
+// CUSTOM
+#include "target_index.h"   // target_index_*, TARGET_INDEX_MODE_*
+#include "uart_helpers.h"   // uart_init_ex, uart_init_t, RX_BUFFER_SIZE
+
+/*      STATIC VARIABLES & CONSTANTS                                */
+
+// Numbers of local containers benchmarked.
+static const uint8_t    NB_CONTAINERS[] = { 1, 8, 32 };
+
+// Maximum number of local containers.
+#define MAX_CONTAINERS      32
+
+// Multicast groups a container listens to.
+#define GROUPS_PER_CONTAINER    2
+
+// Number of matched headers per benchmark.
+#define NB_HEADERS          2000
+
+// ID of the node, and of its first container.
+#define NODE_ID             3
+#define FIRST_ID            10
+
+// Range of the targets of the replayed headers.
+#define TARGET_RANGE        64
+#define TYPE_RANGE          16
+#define FIRST_GROUP         0x100
+#define GROUP_RANGE         32
+#define BROADCAST_ID        0x0FFF
+
+// Local container, as seen by the reference linear scan.
+typedef struct
+{
+    uint16_t    id;
+    uint8_t     type;
+    uint16_t    groups[GROUPS_PER_CONTAINER];
+} container_t;
+
+// Local containers.
+static container_t      s_containers[MAX_CONTAINERS];
+static uint8_t          s_nb_containers = 0;
+
+// Target index of the local containers.
+static target_index_t   s_index;
+
+// Pseudo-random generator state, for the headers.
+static uint32_t         s_random        = 1;
+
+// Line being received.
+static char             s_line[RX_BUFFER_SIZE + 1]  = { 0 };
+
+// Size of the line being received.
+static uint16_t         s_line_size     = 0;
+
+// Stop char
+static const char       STOP_CHAR       = '\r';
+
+/*      STATIC FUNCTIONS                                            */
+
+/* Reads the received characters until a line is complete, then runs the
+** benchmark. Returns false if there was nothing to read.
+*/
+static bool manage_received_data(void);
+
+/* Sets up the given number of local containers, rebuilds the index as a
+** detection would, and prints the cycles taken by both matchers on the
+** same headers.
+*/
+static void benchmark_run(uint8_t nb_containers);
+
+/* Reference matcher: scans the local containers for the given target, as
+** the reception does without an index.
+*/
+static bool linear_match(uint8_t mode, uint16_t target);
+
+// Returns the next pseudo-random number.
+static uint32_t random_next(void);
+
+/*      CALLBACKS                                                   */
+
+/* Data ready:  Calls the data management function until there is
+**              nothing left to read.
+** TX empty:    Does nothing.
+** UART data:   Not supposed to happen.
+** FIFO error:  Logs error.
+** Com error:   Logs error.
+*/
+static void uart_cb(app_uart_evt_t* event);
+
+int main(void)
+{
+    LuosHAL_BoardInit();
+
+    // Needed for UART idle line detection.
+    ret_code_t err_code = app_timer_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Cycle counter, for the benchmark.
+    CoreDebug->DEMCR    |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT         = 0;
+    DWT->CTRL           |= DWT_CTRL_CYCCNTENA_Msk;
+
+    uart_init_t uart_params;
+    memset(&uart_params, 0, sizeof(uart_init_t));
+
+    uart_params.evt_handler     = uart_cb;
+    uart_params.baudrate        = NRF_UART_BAUDRATE_115200;
+    uart_params.flow_control    = false;
+    uart_params.rx_buffer_size  = RX_BUFFER_SIZE;
+
+    uart_init_ex(&uart_params);
+
+    err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps between the events, handled by the callbacks.
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
+}
+
+static bool manage_received_data(void)
+{
+    ssize_t read_bytes = read(0, s_line + s_line_size, 1);
+    if (read_bytes <= 0)
+    {
+        return false;
+    }
+
+    s_line_size++;
+
+    bool complete = (s_line[s_line_size - 1] == STOP_CHAR);
+    if (!complete && (s_line_size < RX_BUFFER_SIZE))
+    {
+        // Line is incomplete.
+        return true;
+    }
+
+    s_line_size = 0;
+
+    for (uint8_t run_idx = 0; run_idx < sizeof(NB_CONTAINERS); run_idx++)
+    {
+        benchmark_run(NB_CONTAINERS[run_idx]);
+    }
+
+    return true;
+}
+
+static void benchmark_run(uint8_t nb_containers)
+{
+    // Detection: IDs are given in turn, and the index is rebuilt.
+    s_nb_containers = nb_containers;
+
+    target_index_clear(&s_index);
+    target_index_node_set(&s_index, NODE_ID);
+
+    for (uint8_t ctn_idx = 0; ctn_idx < nb_containers; ctn_idx++)
+    {
+        container_t* container = &(s_containers[ctn_idx]);
+
+        container->id   = FIRST_ID + ctn_idx;
+        container->type = ctn_idx % TYPE_RANGE;
+
+        target_index_container_add(&s_index, container->id,
+                                   container->type);
+
+        for (uint8_t group_idx = 0; group_idx < GROUPS_PER_CONTAINER;
+             group_idx++)
+        {
+            container->groups[group_idx] = FIRST_GROUP
+                                           + (ctn_idx + group_idx * 7)
+                                             % GROUP_RANGE;
+            target_index_group_add(&s_index,
+                                   container->groups[group_idx]);
+        }
+    }
+
+    s_random = 1;
+
+    uint32_t linear_cycles  = 0;
+    uint32_t index_cycles   = 0;
+    uint32_t accept_count   = 0;
+    uint32_t mismatch_count = 0;
+
+    for (uint16_t hdr_idx = 0; hdr_idx < NB_HEADERS; hdr_idx++)
+    {
+        uint8_t     mode    = random_next() % (TARGET_INDEX_MODE_NODEIDACK
+                                               + 1);
+        uint16_t    target  = 0;
+
+        switch (mode)
+        {
+        case TARGET_INDEX_MODE_TYPE:
+            target = random_next() % TYPE_RANGE;
+            break;
+        case TARGET_INDEX_MODE_BROADCAST:
+            target = BROADCAST_ID;
+            break;
+        case TARGET_INDEX_MODE_MULTICAST:
+            target = FIRST_GROUP + random_next() % (2 * GROUP_RANGE);
+            break;
+        default:
+            target = random_next() % TARGET_RANGE;
+            break;
+        }
+
+        uint32_t start      = DWT->CYCCNT;
+        bool     linear     = linear_match(mode, target);
+        uint32_t middle     = DWT->CYCCNT;
+        bool     indexed    = target_index_match(&s_index, mode, target);
+        uint32_t end        = DWT->CYCCNT;
+
+        linear_cycles   += middle - start;
+        index_cycles    += end - middle;
+        accept_count    += indexed;
+        mismatch_count  += (linear != indexed);
+    }
+
+    uint32_t linear_avg = linear_cycles * 100 / NB_HEADERS;
+    uint32_t index_avg  = index_cycles * 100 / NB_HEADERS;
+
+    printf("%u containers: %u headers, %lu accepted, %lu mismatches!\r\n",
+           nb_containers, NB_HEADERS, accept_count, mismatch_count);
+    printf("  Linear scan: %lu.%02lu cycles/header!\r\n", linear_avg / 100,
+           linear_avg % 100);
+    printf("  Bitmap index: %lu.%02lu cycles/header!\r\n", index_avg / 100,
+           index_avg % 100);
+
+    /* The first container leaves its groups: those shared with other
+    ** containers shall still match.
+    */
+    container_t* leaving = &(s_containers[0]);
+
+    for (uint8_t group_idx = 0; group_idx < GROUPS_PER_CONTAINER;
+         group_idx++)
+    {
+        target_index_group_remove(&s_index, leaving->groups[group_idx]);
+        leaving->groups[group_idx] = 0;
+    }
+
+    mismatch_count = 0;
+
+    for (uint16_t target = FIRST_GROUP;
+         target < FIRST_GROUP + 2 * GROUP_RANGE; target++)
+    {
+        bool linear     = linear_match(TARGET_INDEX_MODE_MULTICAST, target);
+        bool indexed    = target_index_match(&s_index,
+                                             TARGET_INDEX_MODE_MULTICAST,
+                                             target);
+
+        mismatch_count  += (linear != indexed);
+    }
+
+    printf("  Group removal: %lu mismatches!\r\n", mismatch_count);
+}
+
+static bool linear_match(uint8_t mode, uint16_t target)
+{
+    switch (mode)
+    {
+    case TARGET_INDEX_MODE_BROADCAST:
+        return (target == BROADCAST_ID);
+    case TARGET_INDEX_MODE_NODEID:
+    case TARGET_INDEX_MODE_NODEIDACK:
+        return (target == NODE_ID);
+    default:
+        break;
+    }
+
+    for (uint8_t ctn_idx = 0; ctn_idx < s_nb_containers; ctn_idx++)
+    {
+        const container_t* container = &(s_containers[ctn_idx]);
+
+        switch (mode)
+        {
+        case TARGET_INDEX_MODE_ID:
+        case TARGET_INDEX_MODE_IDACK:
+            if (container->id == target)
+            {
+                return true;
+            }
+            break;
+        case TARGET_INDEX_MODE_TYPE:
+            if (container->type == target)
+            {
+                return true;
+            }
+            break;
+        case TARGET_INDEX_MODE_MULTICAST:
+            for (uint8_t group_idx = 0; group_idx < GROUPS_PER_CONTAINER;
+                 group_idx++)
+            {
+                if (container->groups[group_idx] == target)
+                {
+                    return true;
+                }
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+
+    return false;
+}
+
+static uint32_t random_next(void)
+{
+    s_random = s_random * 1103515245 + 12345;
+
+    return (s_random >> 16);
+}
+
+static void uart_cb(app_uart_evt_t* event)
+{
+    switch(event->evt_type)
+    {
+    case APP_UART_DATA_READY:
+        while (manage_received_data());
+        break;
+    case APP_UART_TX_EMPTY:
+        break;
+    case APP_UART_DATA:
+        NRF_LOG_INFO("Non-FIFO data received (\?\?\?)");
+        break;
+    case APP_UART_FIFO_ERROR:
+        NRF_LOG_INFO("Fifo error!");
+        break;
+    case APP_UART_COMMUNICATION_ERROR:
+        NRF_LOG_INFO("Communication error!");
+        break;
+    default:
+        NRF_LOG_INFO("Unknown type!");
+        break;
+    }
+}
@@ -0,0 +1,338 @@
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdatomic.h>      // atomic_uint_fast32_t, atomic_*
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+#include <string.h>         // memset
+
+// NRF
+#include "ble_nus_c.h"      // BLE_NUS_C_DEF, ble_nus_c_*
+#include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "nrf_sdh_ble.h"    // NRF_SDH_BLE_OBSERVER
+#include "sdk_errors.h"     // ret_code_t, NRF_ERROR_*
+
+// NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // APP_TIMER_DEF, app_timer_*
+
+// SOFTDEVICE
+#include "ble.h"            // ble_evt_t
+#include "ble_gattc.h"      // BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE
+
+// HAL
+#include "luos_hal_board.h" // LuosHAL_BoardInit
+#include "luos_hal_ble.h"   /* LuosHAL_BleInit, LuosHAL_BleSetup,
+                            ** LuosHAL_BleConnect
+                            */
+
+// CUSTOM
+#include "luos_hal_ble_client_ctx.h"    // g_ptp_client_ptr, g_nus_c_ptr
+#include "ptp_client.h"     // PTP_CLIENT_DEF, ptp_client_*
+
+#ifdef COM_BACKEND_L2CAP
+#include "ble_l2cap_ch.h"   // BLE_L2CAP_CH_DEF, ble_l2cap_ch_*
+#include "msg_queue.h"      // MSG_QUEUE_DEF, msg_queue_inst_*
+#endif /* COM_BACKEND_L2CAP */
+
+/*      GLOBAL/STATIC VARIABLES & CONSTANTS                         */
+
+// PTP Client instance.
+PTP_CLIENT_DEF(s_ptp_client);
+
+// Global accessor to PTP instance.
+ptp_client_t* g_ptp_client_ptr;
+
+// Global accessor to NUS client instance.
+ble_nus_c_t*    g_nus_c_ptr;
+
+#ifdef COM_BACKEND_L2CAP
+
+// Size of a sent message: a whole SDU.
+#define MSG_SIZE        BLE_L2CAP_CH_SDU_SIZE
+
+// L2CAP channel instance.
+BLE_L2CAP_CH_DEF(s_l2cap_ch);
+
+#else
+
+// Size of a sent message: a whole write command.
+#define MSG_SIZE        BLE_NUS_MAX_DATA_LEN
+
+// NUS client instance.
+BLE_NUS_C_DEF(s_nus_c);
+
+// Set once the NUS server handles are known.
+static bool     s_nus_ready     = false;
+
+// Throughput BLE observer priority.
+#define THROUGHPUT_BLE_OBS_PRIO 3
+
+#endif /* COM_BACKEND_L2CAP */
+
+// Number of messages waiting to be sent.
+#define TX_QUEUE_DEPTH  4
+
+// Queue of the messages to send.
+MSG_QUEUE_DEF(s_tx_queue, TX_QUEUE_DEPTH, MSG_SIZE);
+
+// Throughput report period.
+#define REPORT_PERIOD_MS    1000
+
+// Throughput report timer.
+APP_TIMER_DEF(s_report_timer);
+
+// Sent message, filled with a counting pattern.
+static uint8_t              s_payload[MSG_SIZE] = { 0 };
+
+// Number of bytes sent since the last report.
+static atomic_uint_fast32_t s_nb_bytes          = 0;
+
+/*      STATIC FUNCTIONS                                            */
+
+// Initializes the static PTP client instance.
+static void init_ptp_client(void);
+
+// Initializes the link carrying the measured traffic.
+static void init_com_backend(void);
+
+// Creates and starts the report timer.
+static void init_report_timer(void);
+
+// Hands messages to the link until it cannot take more.
+static void payload_send(void);
+
+/*      CALLBACKS                                                   */
+
+// DB Discovery complete:   Assigns the internal handles.
+static void ptp_client_evt_handler(const ptp_client_evt_t* event,
+                                   ptp_client_t* instance);
+
+#ifdef COM_BACKEND_L2CAP
+
+/* Opened:  Starts sending.
+** TX:      Sends the next messages.
+** Others:  Do nothing.
+*/
+static void l2cap_ch_evt_handler(const ble_l2cap_ch_evt_t* event);
+
+#else
+
+/* Discovery complete:  Assigns the handles and starts sending.
+** Disconnected:        Stops sending.
+** Others:              Do nothing.
+*/
+static void nus_c_evt_handler(ble_nus_c_t* instance,
+                              const ble_nus_c_evt_t* event);
+
+// Write command sent:  Sends the next messages.
+static void throughput_on_ble_evt(ble_evt_t const* event, void* context);
+
+NRF_SDH_BLE_OBSERVER(s_throughput_ble_obs, THROUGHPUT_BLE_OBS_PRIO,
+                     throughput_on_ble_evt, NULL);
+
+#endif /* COM_BACKEND_L2CAP */
+
+// Logs the number of bytes sent during the period, then resets it.
+static void report_timer_handler(void* context);
+
+int main(void)
+{
+    LuosHAL_BoardInit();
+
+    LuosHAL_BleInit();
+
+    for (uint16_t byte_idx = 0; byte_idx < MSG_SIZE; byte_idx++)
+    {
+        s_payload[byte_idx] = (uint8_t)byte_idx;
+    }
+
+    init_ptp_client();
+    init_com_backend();
+    init_report_timer();
+
+    LuosHAL_BleSetup();
+    LuosHAL_BleConnect();
+
+    ret_code_t err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps between the events, handled by the callbacks.
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
+}
+
+static void init_ptp_client(void)
+{
+    ptp_client_init_t params;
+    memset(&params, 0, sizeof(ptp_client_init_t));
+
+    params.evt_handler = ptp_client_evt_handler;
+
+    ptp_client_init(&s_ptp_client, &params);
+
+    g_ptp_client_ptr = &s_ptp_client;
+}
+
+static void init_com_backend(void)
+{
+    #ifdef COM_BACKEND_L2CAP
+    ble_l2cap_ch_init_t params;
+    memset(&params, 0, sizeof(ble_l2cap_ch_init_t));
+
+    params.evt_handler  = l2cap_ch_evt_handler;
+    params.tx_queues[0] = &s_tx_queue;
+
+    ble_l2cap_ch_init(&s_l2cap_ch, &params);
+
+    g_nus_c_ptr = NULL;
+    #else
+    ble_nus_c_init_t params;
+    memset(&params, 0, sizeof(ble_nus_c_init_t));
+
+    params.evt_handler = nus_c_evt_handler;
+
+    ret_code_t err_code = ble_nus_c_init(&s_nus_c, &params);
+    APP_ERROR_CHECK(err_code);
+
+    g_nus_c_ptr = &s_nus_c;
+    #endif /* COM_BACKEND_L2CAP */
+}
+
+static void init_report_timer(void)
+{
+    ret_code_t err_code = app_timer_create(&s_report_timer,
+                                           APP_TIMER_MODE_REPEATED,
+                                           report_timer_handler);
+    APP_ERROR_CHECK(err_code);
+
+    err_code = app_timer_start(s_report_timer,
+                               APP_TIMER_TICKS(REPORT_PERIOD_MS), NULL);
+    APP_ERROR_CHECK(err_code);
+}
+
+static void payload_send(void)
+{
+    #ifdef COM_BACKEND_L2CAP
+    while (msg_queue_inst_enqueue(&s_tx_queue, s_payload, MSG_SIZE));
+
+    ble_l2cap_ch_tx_kick(&s_l2cap_ch);
+    #else
+    if (!s_nus_ready)
+    {
+        return;
+    }
+
+    while (msg_queue_inst_enqueue(&s_tx_queue, s_payload, MSG_SIZE));
+
+    // One peek and one pop for the whole batch handed to the SoftDevice.
+    tx_buffer_t views[TX_QUEUE_DEPTH];
+    uint16_t    nb_peeked   = msg_queue_inst_peek_n(&s_tx_queue, views,
+                                                    TX_QUEUE_DEPTH);
+    uint16_t    nb_sent     = 0;
+
+    while (nb_sent < nb_peeked)
+    {
+        ret_code_t err_code = ble_nus_c_string_send(&s_nus_c,
+                                                    views[nb_sent].buffer,
+                                                    views[nb_sent].size);
+        if (err_code != NRF_SUCCESS)
+        {
+            // Write commands queue full, or disconnected.
+            break;
+        }
+
+        nb_sent++;
+    }
+
+    msg_queue_inst_pop_n(&s_tx_queue, nb_sent);
+
+    atomic_fetch_add(&s_nb_bytes, nb_sent * MSG_SIZE);
+    #endif /* COM_BACKEND_L2CAP */
+}
+
+static void ptp_client_evt_handler(const ptp_client_evt_t* event,
+                                   ptp_client_t* instance)
+{
+    switch (event->evt_type)
+    {
+    case PTP_C_DB_DISCOVERY_COMPLETE:
+        ptp_client_link_handles_assign(instance, event->conn_handle,
+                                       &(event->content.disc_db));
+        break;
+    default:
+        break;
+    }
+}
+
+#ifdef COM_BACKEND_L2CAP
+
+static void l2cap_ch_evt_handler(const ble_l2cap_ch_evt_t* event)
+{
+    switch (event->evt_type)
+    {
+    case BLE_L2CAP_CH_EVT_OPENED:
+        NRF_LOG_INFO("L2CAP channel open: sending!");
+        payload_send();
+        break;
+    case BLE_L2CAP_CH_EVT_TX:
+        atomic_fetch_add(&s_nb_bytes, MSG_SIZE);
+        payload_send();
+        break;
+    default:
+        break;
+    }
+}
+
+#else
+
+static void nus_c_evt_handler(ble_nus_c_t* instance,
+                              const ble_nus_c_evt_t* event)
+{
+    switch (event->evt_type)
+    {
+    case BLE_NUS_C_EVT_DISCOVERY_COMPLETE:
+    {
+        ret_code_t err_code = ble_nus_c_handles_assign(instance,
+                                                       event->conn_handle,
+                                                       &(event->handles));
+        APP_ERROR_CHECK(err_code);
+
+        NRF_LOG_INFO("NUS discovered: sending!");
+
+        s_nus_ready = true;
+        payload_send();
+    }
+        break;
+    case BLE_NUS_C_EVT_DISCONNECTED:
+        s_nus_ready = false;
+        break;
+    default:
+        break;
+    }
+}
+
+static void throughput_on_ble_evt(ble_evt_t const* event, void* context)
+{
+    switch (event->header.evt_id)
+    {
+    case BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE:
+        payload_send();
+        break;
+    default:
+        break;
+    }
+}
+
+#endif /* COM_BACKEND_L2CAP */
+
+static void report_timer_handler(void* context)
+{
+    uint32_t nb_bytes = atomic_exchange(&s_nb_bytes, 0);
+
+    NRF_LOG_INFO("Sent: %lu bytes in %u ms (%lu kbps)!", nb_bytes,
+                 REPORT_PERIOD_MS, nb_bytes * 8 / REPORT_PERIOD_MS);
+}
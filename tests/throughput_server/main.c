@@ -0,0 +1,174 @@
+/*      INCLUDES                                                    */
+
+// C STANDARD
+#include <stdatomic.h>      // atomic_uint_fast32_t, atomic_*
+#include <stdbool.h>        // bool
+#include <stdint.h>         // uint*_t
+#include <string.h>         // memset
+
+// NRF
+#include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "sdk_errors.h"     // ret_code_t
+
+// NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // APP_TIMER_DEF, app_timer_*
+
+// HAL
+#include "luos_hal_board.h" // LuosHAL_BoardInit
+#include "luos_hal_ble.h"   /* LuosHAL_BleInit, LuosHAL_BleSetup,
+                            ** LuosHAL_BleConnect
+                            */
+
+// CUSTOM
+#ifdef COM_BACKEND_L2CAP
+#include "ble_l2cap_ch.h"   // BLE_L2CAP_CH_DEF, ble_l2cap_ch_*
+#else
+#include "ble_nus.h"        // BLE_NUS_DEF, ble_nus_*
+#endif /* COM_BACKEND_L2CAP */
+
+/*      STATIC VARIABLES AND CONSTANTS                              */
+
+#ifdef COM_BACKEND_L2CAP
+
+// L2CAP channel instance.
+BLE_L2CAP_CH_DEF(s_l2cap_ch);
+
+#else
+
+// NUS server instance.
+BLE_NUS_DEF(s_nus, NRF_SDH_BLE_TOTAL_LINK_COUNT);
+
+#endif /* COM_BACKEND_L2CAP */
+
+// Throughput report period.
+#define REPORT_PERIOD_MS    1000
+
+// Throughput report timer.
+APP_TIMER_DEF(s_report_timer);
+
+// Number of bytes received since the last report.
+static atomic_uint_fast32_t s_nb_bytes  = 0;
+
+/*      STATIC FUNCTIONS                                            */
+
+// Initializes the link carrying the measured traffic.
+static void init_com_backend(void);
+
+// Creates and starts the report timer.
+static void init_report_timer(void);
+
+/*      CALLBACKS                                                   */
+
+#ifdef COM_BACKEND_L2CAP
+
+/* RX:      Counts the received bytes.
+** Others:  Do nothing.
+*/
+static void l2cap_ch_evt_handler(const ble_l2cap_ch_evt_t* event);
+
+#else
+
+/* RX data: Counts the received bytes.
+** Others:  Do nothing.
+*/
+static void nus_data_handler(ble_nus_evt_t* event);
+
+#endif /* COM_BACKEND_L2CAP */
+
+// Logs the number of bytes received during the period, then resets it.
+static void report_timer_handler(void* context);
+
+int main(void)
+{
+    LuosHAL_BoardInit();
+
+    LuosHAL_BleInit();
+
+    init_com_backend();
+    init_report_timer();
+
+    LuosHAL_BleSetup();
+    LuosHAL_BleConnect();
+
+    ret_code_t err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps between the events, handled by the callbacks.
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
+}
+
+static void init_com_backend(void)
+{
+    #ifdef COM_BACKEND_L2CAP
+    ble_l2cap_ch_init_t params;
+    memset(&params, 0, sizeof(ble_l2cap_ch_init_t));
+
+    // Nothing to send: the queues stay NULL.
+    params.evt_handler  = l2cap_ch_evt_handler;
+
+    ble_l2cap_ch_init(&s_l2cap_ch, &params);
+    #else
+    ble_nus_init_t params;
+    memset(&params, 0, sizeof(ble_nus_init_t));
+
+    params.data_handler = nus_data_handler;
+
+    ret_code_t err_code = ble_nus_init(&s_nus, &params);
+    APP_ERROR_CHECK(err_code);
+    #endif /* COM_BACKEND_L2CAP */
+}
+
+static void init_report_timer(void)
+{
+    ret_code_t err_code = app_timer_create(&s_report_timer,
+                                           APP_TIMER_MODE_REPEATED,
+                                           report_timer_handler);
+    APP_ERROR_CHECK(err_code);
+
+    err_code = app_timer_start(s_report_timer,
+                               APP_TIMER_TICKS(REPORT_PERIOD_MS), NULL);
+    APP_ERROR_CHECK(err_code);
+}
+
+#ifdef COM_BACKEND_L2CAP
+
+static void l2cap_ch_evt_handler(const ble_l2cap_ch_evt_t* event)
+{
+    switch (event->evt_type)
+    {
+    case BLE_L2CAP_CH_EVT_RX:
+        atomic_fetch_add(&s_nb_bytes, event->size);
+        break;
+    default:
+        break;
+    }
+}
+
+#else
+
+static void nus_data_handler(ble_nus_evt_t* event)
+{
+    switch (event->type)
+    {
+    case BLE_NUS_EVT_RX_DATA:
+        atomic_fetch_add(&s_nb_bytes, event->params.rx_data.length);
+        break;
+    default:
+        break;
+    }
+}
+
+#endif /* COM_BACKEND_L2CAP */
+
+static void report_timer_handler(void* context)
+{
+    uint32_t nb_bytes = atomic_exchange(&s_nb_bytes, 0);
+
+    NRF_LOG_INFO("Received: %lu bytes in %u ms (%lu kbps)!", nb_bytes,
+                 REPORT_PERIOD_MS, nb_bytes * 8 / REPORT_PERIOD_MS);
+}
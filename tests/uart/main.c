@@ -2,37 +2,71 @@
 
 // C STANDARD
 #include <stdbool.h>        // bool
+#include <stdio.h>          // printf
+#include <string.h>         // memset, strncmp
 #include <unistd.h>         // read
 
 // NRF
 #include "nrf_log.h"        // NRF_LOG_INFO
+#include "nrf_pwr_mgmt.h"   // nrf_pwr_mgmt_init, nrf_pwr_mgmt_run
+#include "nrf_uart.h"       // NRF_UART_BAUDRATE_*
+#include "sdk_errors.h"     // ret_code_t
 
 // NRF APPS
+#include "app_error.h"      // APP_ERROR_CHECK
+#include "app_timer.h"      // app_timer_init
 #include "app_uart.h"       // app_uart_*
 
 // LUOS
 #include "luos_hal_board.h" // LuosHAL_BoardInit
 
 // CUSTOM
-#include "uart_helpers.h"   // uart_init
+#include "uart_helpers.h"   /* uart_init_ex, uart_init_t, uart_link_set,
+                            ** RX_BUFFER_SIZE
+                            */
 
 /*      STATIC VARIABLES & CONSTANTS*/
 
 // Size of a read operation.
 #define READ_SIZE   8
 
+// Baudrate switch string, acknowledged before switching.
+#define FAST_STRING         "fast"
+static const uint16_t FAST_STRING_SIZE = sizeof(FAST_STRING) - 1;
+
 /*      CALLBACKS                                                   */
 
-// Prints the received characters.
+/* Prints the received characters. On reception of the baudrate switch
+** string, acknowledges it and switches to 1 Mbaud with flow control.
+*/
 static void uart_cb(app_uart_evt_t* event);
 
 int main(void)
 {
     LuosHAL_BoardInit();
 
-    uart_init(uart_cb);
+    // Needed for UART idle line detection.
+    ret_code_t err_code = app_timer_init();
+    APP_ERROR_CHECK(err_code);
+
+    uart_init_t uart_params;
+    memset(&uart_params, 0, sizeof(uart_init_t));
+
+    uart_params.evt_handler     = uart_cb;
+    uart_params.baudrate        = NRF_UART_BAUDRATE_115200;
+    uart_params.flow_control    = false;
+    uart_params.rx_buffer_size  = RX_BUFFER_SIZE;
+
+    uart_init_ex(&uart_params);
 
-    while (true);
+    err_code = nrf_pwr_mgmt_init();
+    APP_ERROR_CHECK(err_code);
+
+    // Sleeps between the events, handled by the callbacks.
+    while (true)
+    {
+        nrf_pwr_mgmt_run();
+    }
 }
 
 static void uart_cb(app_uart_evt_t* event)
@@ -41,18 +75,28 @@ static void uart_cb(app_uart_evt_t* event)
     {
     case APP_UART_DATA_READY:
     {
-        char received[READ_SIZE] = { 0 };
-        ssize_t read_bytes = read(0, received, READ_SIZE);
-        if (read_bytes == -1)
+        ssize_t read_bytes;
+        do
         {
-            NRF_LOG_INFO("Read error!");
-            break;
-        }
+            char received[READ_SIZE + 1] = { 0 };
+            read_bytes = read(0, received, READ_SIZE);
+            if (read_bytes == -1)
+            {
+                NRF_LOG_INFO("Read error!");
+                break;
+            }
+
+            if (read_bytes == 0)
+                break;
 
-        if (read_bytes == 0)
-            break;
+            NRF_LOG_INFO("Received %d bytes: %s!", read_bytes, received);
 
-        NRF_LOG_INFO("Received %d bytes: %s!", read_bytes, received);
+            if (strncmp(received, FAST_STRING, FAST_STRING_SIZE) == 0)
+            {
+                printf("OK\r\n");
+                uart_link_set(NRF_UART_BAUDRATE_1000000, true);
+            }
+        } while (read_bytes == READ_SIZE);
     }
         break;
     case APP_UART_TX_EMPTY: